@@ -0,0 +1,41 @@
+/**
+ * @file evaluation.cpp
+ * @brief Compile-time generation of the piece-square tables
+ */
+
+#include "evaluation.h"
+
+//! Expand the generator f of the piece p of the color c for the 8 squares of the row r
+#define EVAL_TABLE_ROW(f, c, p, r) \
+  f(c, p, 8 * r + 0), f(c, p, 8 * r + 1), f(c, p, 8 * r + 2), f(c, p, 8 * r + 3), \
+  f(c, p, 8 * r + 4), f(c, p, 8 * r + 5), f(c, p, 8 * r + 6), f(c, p, 8 * r + 7)
+
+//! Expand the generator f of the piece p of the color c for all the squares of the board
+#define EVAL_TABLE(f, c, p) { \
+  EVAL_TABLE_ROW(f, c, p, 0), EVAL_TABLE_ROW(f, c, p, 1), EVAL_TABLE_ROW(f, c, p, 2), EVAL_TABLE_ROW(f, c, p, 3), \
+  EVAL_TABLE_ROW(f, c, p, 4), EVAL_TABLE_ROW(f, c, p, 5), EVAL_TABLE_ROW(f, c, p, 6), EVAL_TABLE_ROW(f, c, p, 7) }
+
+//! Expand the tables of all the pieces of the color c
+#define EVAL_COLOR(f, c) { \
+  EVAL_TABLE(f, c, 0), EVAL_TABLE(f, c, 1), EVAL_TABLE(f, c, 2), \
+  EVAL_TABLE(f, c, 3), EVAL_TABLE(f, c, 4), EVAL_TABLE(f, c, 5) }
+
+// Spot checks of the generators, evaluated by the compiler
+static_assert(pieceSquareMg(0, 3, 27) == 337 + 20 - 6, "Wrong knight table on D4");
+static_assert(pieceSquareMg(1, 5, 52) == -82, "Wrong black pawn table on E7");
+static_assert(pieceSquareEg(0, 0, 0) == -40, "Wrong king endgame table on A1");
+static_assert(pieceSquareMg(0, 2, 10) == -pieceSquareMg(1, 2, 50), "The black tables must mirror the white ones");
+
+constexpr int16_t PIECE_SQUARE_MG[2][6][BOARD_SQUARES] = {
+  EVAL_COLOR(pieceSquareMg, 0),
+  EVAL_COLOR(pieceSquareMg, 1)
+};
+
+constexpr int16_t PIECE_SQUARE_EG[2][6][BOARD_SQUARES] = {
+  EVAL_COLOR(pieceSquareEg, 0),
+  EVAL_COLOR(pieceSquareEg, 1)
+};
+
+constexpr uint8_t PIECE_PHASE[6] = {
+  piecePhase(0), piecePhase(1), piecePhase(2), piecePhase(3), piecePhase(4), piecePhase(5)
+};
@@ -0,0 +1,102 @@
+/**
+ * @file evaluation.h
+ * @brief Material and piece-square tables of the static evaluation
+ *
+ * Every piece on every square has a midgame and an endgame score, material
+ * included. The Board keeps the sums of the scores of the pieces on the board
+ * and the game phase, updated by every piece change, so the evaluation of a
+ * position is the blend of the two sums by the phase.
+ *
+ * The tables are calculated at compile time from a few rules (central pieces
+ * are stronger, pawns gain value advancing, the King hides in the midgame and
+ * centralizes in the endgame) and stored as constant data (flash on the
+ * MKR1010). The scores are in centipawns, positive for white.
+ */
+
+#ifndef _EVALUATION
+#define _EVALUATION
+
+#include <stdint.h>
+
+#include "bitboard.h"
+
+//! Phase of the starting position, the phase drops to 0 when only Kings and pawns are left
+#define PHASE_MAX 24
+
+//! Midgame material value, in ChessPiece order
+constexpr int16_t pieceValueMg(int p) {
+  return (p == 1) ? 1025 : (p == 2) ? 365 : (p == 3) ? 337 : (p == 4) ? 477 : (p == 5) ? 82 : 0;
+}
+
+//! Endgame material value, in ChessPiece order
+constexpr int16_t pieceValueEg(int p) {
+  return (p == 1) ? 936 : (p == 2) ? 297 : (p == 3) ? 281 : (p == 4) ? 512 : (p == 5) ? 94 : 0;
+}
+
+//! Weight of a piece in the game phase, in ChessPiece order
+constexpr int piecePhase(int p) {
+  return (p == 1) ? 4 : (p == 4) ? 2 : (p == 2 || p == 3) ? 1 : 0;
+}
+
+//! Absolute value
+constexpr int evalAbs(int n) {
+  return (n < 0) ? -n : n;
+}
+
+//! Distance of a square from the center, 1 on the four central squares up to 7 on the corners
+constexpr int centerDistance(int x, int y) {
+  return (evalAbs(2 * x - 7) + evalAbs(2 * y - 7)) / 2;
+}
+
+/**
+ * Midgame score of a white piece on a square, material included
+ *
+ * @param p The piece, in ChessPiece order
+ * @param x, y The square coordinates
+ */
+constexpr int16_t whiteScoreMg(int p, int x, int y) {
+  return pieceValueMg(p) +
+    ((p == 0) ? ((y == 0) ? ((x <= 2 || x >= 6) ? 20 : 0) : -15 * (y < 4 ? y : 4)) :   // King shelter
+     (p == 1) ? 8 - 2 * centerDistance(x, y) :                                        // Queen
+     (p == 2) ? 12 - 3 * centerDistance(x, y) :                                       // Bishop
+     (p == 3) ? 20 - 6 * centerDistance(x, y) :                                       // Knight
+     (p == 4) ? ((y == 6) ? 20 : 0) + ((x == 3 || x == 4) ? 5 : 0) :                  // Rook
+     (y == 0 || y == 7) ? 0 : 4 * (y - 1) + (((x == 3 || x == 4) && y >= 2 && y <= 4) ? 15 : 0));  // Pawn
+}
+
+/**
+ * Endgame score of a white piece on a square, material included
+ *
+ * @param p The piece, in ChessPiece order
+ * @param x, y The square coordinates
+ */
+constexpr int16_t whiteScoreEg(int p, int x, int y) {
+  return pieceValueEg(p) +
+    ((p == 0) ? 30 - 10 * centerDistance(x, y) :                                      // King
+     (p == 1) ? 12 - 4 * centerDistance(x, y) :                                       // Queen
+     (p == 2) ? 8 - 3 * centerDistance(x, y) :                                        // Bishop
+     (p == 3) ? 15 - 5 * centerDistance(x, y) :                                       // Knight
+     (p == 4) ? ((y == 6) ? 10 : 0) :                                                 // Rook
+     (y == 0 || y == 7) ? 0 : 12 * (y - 1));                                          // Pawn
+}
+
+//! Midgame score of a piece of a color on a square, negative for black
+constexpr int16_t pieceSquareMg(int c, int p, int s) {
+  return (c == 0) ? whiteScoreMg(p, s & 7, s >> 3) : -whiteScoreMg(p, s & 7, 7 - (s >> 3));
+}
+
+//! Endgame score of a piece of a color on a square, negative for black
+constexpr int16_t pieceSquareEg(int c, int p, int s) {
+  return (c == 0) ? whiteScoreEg(p, s & 7, s >> 3) : -whiteScoreEg(p, s & 7, 7 - (s >> 3));
+}
+
+//! Midgame scores indexed by color, piece and square
+extern const int16_t PIECE_SQUARE_MG[2][6][BOARD_SQUARES];
+
+//! Endgame scores indexed by color, piece and square
+extern const int16_t PIECE_SQUARE_EG[2][6][BOARD_SQUARES];
+
+//! Game phase weight of every piece, in ChessPiece order
+extern const uint8_t PIECE_PHASE[6];
+
+#endif
@@ -0,0 +1,230 @@
+/**
+ * @file http_parser.cpp
+ * @brief State machine of the HTTP request parser
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "http_parser.h"
+
+#define HTTP_STATE_METHOD   0   //!< Reading the method
+#define HTTP_STATE_TARGET   1   //!< Reading the request target
+#define HTTP_STATE_VERSION  2   //!< Skipping the protocol version
+#define HTTP_STATE_HEADERS  3   //!< Skipping the headers, up to the empty line
+#define HTTP_STATE_DONE     4   //!< The request is complete
+
+//! Longest head of the answers
+#define HTTP_HEAD_SIZE      128
+
+//! The header read, lowercase, up to its value
+static const char CONNECTION_HEADER[] = "connection:";
+
+//! Length of CONNECTION_HEADER: the value of the header follows
+#define HTTP_HEADER_VALUE   (sizeof(CONNECTION_HEADER) - 1)
+
+//! The current header line is not the Connection header, or its value has been read
+#define HTTP_HEADER_SKIP    255
+
+void HttpParser::begin() {
+  requests = 0;
+  reset();
+}
+
+void HttpParser::reset() {
+  state = HTTP_STATE_METHOD;
+  target[0] = '\0';
+  length = 0;
+  queryStart = 0;
+  lineLength = 0;
+  methodLength = 0;
+  method = HTTP_METHOD_GET;
+  header = 0;
+  persistent = true;
+  deferred = false;
+  errorStatus = 0;
+}
+
+int HttpParser::feed(char c) {
+  switch (state) {
+    case HTTP_STATE_METHOD:
+      if (c == ' ') {
+        if (methodLength != 3) {
+          method = HTTP_METHOD_OTHER;
+        }
+        state = HTTP_STATE_TARGET;
+      }
+      else if (c == '\r' || c == '\n') {
+        // Empty lines before the request are allowed, a broken request line is not
+        if (methodLength > 0) {
+          errorStatus = 400;
+          return HTTP_PARSE_ERROR;
+        }
+      }
+      else {
+        if (methodLength >= 3 || c != "GET"[methodLength]) {
+          method = HTTP_METHOD_OTHER;
+        }
+        if (methodLength < 255) {
+          methodLength++;
+        }
+      }
+      break;
+
+    case HTTP_STATE_TARGET:
+      if (c == ' ') {
+        target[length] = '\0';
+        if (queryStart == 0) {
+          queryStart = length;
+        }
+        state = HTTP_STATE_VERSION;
+      }
+      else if (c == '\r' || c == '\n') {
+        errorStatus = 400;
+        return HTTP_PARSE_ERROR;
+      }
+      else if (length >= HTTP_TARGET_SIZE - 1) {
+        errorStatus = 414;
+      }
+      else if (c == '?' && queryStart == 0) {
+        // The path ends here, the query starts after the terminator
+        target[length++] = '\0';
+        queryStart = length;
+      }
+      else {
+        target[length++] = c;
+      }
+      break;
+
+    case HTTP_STATE_VERSION:
+      if (c == '\n') {
+        lineLength = 0;
+        state = HTTP_STATE_HEADERS;
+      }
+      else if (c != '\r') {
+        // The connections of HTTP/1.0 close after the answer unless asked otherwise
+        persistent = (c != '0');
+      }
+      break;
+
+    case HTTP_STATE_HEADERS:
+      if (c == '\n') {
+        if (lineLength == 0) {
+          state = HTTP_STATE_DONE;
+          if (requests < 255) {
+            requests++;
+          }
+          return errorStatus ? HTTP_PARSE_ERROR : HTTP_PARSE_DONE;
+        }
+        lineLength = 0;
+        header = 0;
+      }
+      else if (c != '\r') {
+        lineLength = 1;
+        if (header < HTTP_HEADER_VALUE) {
+          header = ((c | 0x20) == CONNECTION_HEADER[header]) ? header + 1 : HTTP_HEADER_SKIP;
+        }
+        else if (header == HTTP_HEADER_VALUE && c != ' ' && c != '\t') {
+          // "close" or "keep-alive", the first letter tells them apart
+          if ((c | 0x20) == 'c') {
+            persistent = false;
+          }
+          else if ((c | 0x20) == 'k') {
+            persistent = true;
+          }
+          header = HTTP_HEADER_SKIP;
+        }
+      }
+      break;
+
+    case HTTP_STATE_DONE:
+      return errorStatus ? HTTP_PARSE_ERROR : HTTP_PARSE_DONE;
+  }
+  return HTTP_PARSE_MORE;
+}
+
+int HttpParser::feed(const char* data, int size, int& used) {
+  int result = HTTP_PARSE_MORE;
+
+  for (used = 0; used < size && result == HTTP_PARSE_MORE; used++) {
+    // Most of a request are headers, skipped up to the end of the line
+    // unless the line can be the Connection header
+    if (state == HTTP_STATE_HEADERS && data[used] != '\n' &&
+        (header == HTTP_HEADER_SKIP || (lineLength == 0 && (data[used] | 0x20) != CONNECTION_HEADER[0]))) {
+      const char* end = (const char*)memchr(data + used, '\n', size - used);
+      int skipped = (end != NULL ? end - data : size) - used;
+      if (skipped > 1 || data[used] != '\r') {
+        lineLength = 1;
+      }
+      // The rest of the line, also in the next block, is not the Connection header
+      header = HTTP_HEADER_SKIP;
+      used += skipped;
+      if (used == size) {
+        break;
+      }
+    }
+    result = feed(data[used]);
+  }
+  return result;
+}
+
+bool HttpParser::keepAlive() const {
+  // After a malformed request or one with a body the next request cannot be found
+  return persistent && errorStatus == 0 && method == HTTP_METHOD_GET && requests < HTTP_KEEP_ALIVE_REQUESTS;
+}
+
+bool HttpParser::dispatch(Print& out, const HttpRoute* routes, int count) {
+  if (errorStatus) {
+    respond(out, errorStatus, "");
+    return false;
+  }
+  if (method != HTTP_METHOD_GET) {
+    respond(out, 405, "");
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    if (strcmp(routes[i].path, path()) == 0) {
+      routes[i].handler(out, *this);
+      return true;
+    }
+  }
+  respond(out, 404, "");
+  return false;
+}
+
+//! Reason phrase of the HTTP statuses answered by the server
+static const char* httpReason(int status) {
+  switch (status) {
+    case 200: return "OK";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 414: return "URI Too Long";
+  }
+  return "Error";
+}
+
+void httpRespond(Print& out, int status, const char* body, bool keepAlive) {
+  // The head and the body are written as two blocks: every write to the
+  // WiFi client is a SPI transaction and possibly a TCP segment
+  char head[HTTP_HEAD_SIZE];
+  size_t length = strlen(body);
+  int size = snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\nContent-Type: text/plain\r\nContent-Length: %u\r\n"
+                      "Connection: %s\r\n\r\n", status, httpReason(status), (unsigned)length,
+                      keepAlive ? "keep-alive" : "close");
+
+  out.write((const uint8_t*)head, size);
+  out.write((const uint8_t*)body, length);
+}
+
+void HttpParser::respondEvents(Print& out) {
+  out.print("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n\r\n");
+  defer();
+}
+
+void httpEvent(Print& out, const char* data) {
+  char event[HTTP_EVENT_SIZE];
+  int size = snprintf(event, sizeof(event), "data: %s\n\n", data);
+
+  out.write((const uint8_t*)event, (size < (int)sizeof(event)) ? size : sizeof(event) - 1);
+}
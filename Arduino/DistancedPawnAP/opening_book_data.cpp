@@ -0,0 +1,172 @@
+/**
+ * @file opening_book_data.cpp
+ * @brief Opening book records, generated by book_maker from sample.pgn
+ */
+
+#include "opening_book.h"
+
+const BookEntry OPENING_BOOK[] PROGMEM = {
+  { 0x00A930BBUL, 0xFC356708UL, 0x04CB,     1 },  // d2d3
+  { 0x03192222UL, 0x19C85F1AUL, 0x0982,     2 },  // c1g5
+  { 0x032AE285UL, 0x227AE1F5UL, 0xCFBC,     1 },  // e8g8
+  { 0x04152A40UL, 0x5BD54452UL, 0x0481,     2 },  // b1c3
+  { 0x04AE14DBUL, 0xE20B4E16UL, 0x0934,     2 },  // e7e5
+  { 0x07DA945CUL, 0x246C4D59UL, 0x0915,     1 },  // f3e5
+  { 0x0955C830UL, 0x51DFE9EBUL, 0x0B7E,     1 },  // g8f6
+  { 0x096331F5UL, 0xB706C885UL, 0x0481,     1 },  // b1c3
+  { 0x09AEE624UL, 0x6A63C958UL, 0x096B,     1 },  // d6f5
+  { 0x0B694834UL, 0x45B78754UL, 0x0B7E,     1 },  // g8f6
+  { 0x0DF1773AUL, 0x4EB7E3DEUL, 0x0AB9,     1 },  // b8c6
+  { 0x0E597310UL, 0x5DAC75AEUL, 0x0B3A,     2 },  // c8e6
+  { 0x1222E157UL, 0xA5FF53D0UL, 0x0712,     1 },  // c3e4
+  { 0x14910B7CUL, 0x865DF38AUL, 0x0564,     1 },  // e5f3
+  { 0x14A0656EUL, 0x4DBC767DUL, 0x04C5,     1 },  // f1d3
+  { 0x16168E0FUL, 0x706400D8UL, 0x0481,     2 },  // b1c3
+  { 0x16168E0FUL, 0x706400D8UL, 0x091C,     1 },  // e4e5
+  { 0x16FF4FCFUL, 0x608EA078UL, 0x08B2,     1 },  // c7c5
+  { 0x1964CC64UL, 0x6982C57CUL, 0x04CB,     2 },  // d2d3
+  { 0x19771002UL, 0x81AEBDB4UL, 0x0BF7,     1 },  // h7h6
+  { 0x1BA6AF9AUL, 0x7734288EUL, 0x0546,     2 },  // g1f3
+  { 0x1BF5F081UL, 0xBC87EAB2UL, 0x0A9B,     2 },  // d4c6
+  { 0x1C5A641DUL, 0x3873B629UL, 0x0934,     1 },  // e7e5
+  { 0x1C6C9DD8UL, 0xDEAA9747UL, 0x0982,     1 },  // c1g5
+  { 0x1E483242UL, 0x3FFDBA6BUL, 0xCFBC,     1 },  // e8g8
+  { 0x20E1A01BUL, 0x9D45D767UL, 0x097A,     2 },  // c8f5
+  { 0x27EFF279UL, 0x2B857EFDUL, 0x0AF3,     1 },  // d7d6
+  { 0x2871DF1DUL, 0x0D9D7014UL, 0x0A30,     1 },  // a7a6
+  { 0x2871DF1DUL, 0x0D9D7014UL, 0x0B7E,     1 },  // g8f6
+  { 0x2A6842A8UL, 0xEEA3D734UL, 0x0B34,     1 },  // e7e6
+  { 0x2A6A33C5UL, 0x8BCBE4C9UL, 0x0AFD,     1 },  // f8d6
+  { 0x2AE25CB9UL, 0x9AAF4C52UL, 0x048A,     2 },  // c2c3
+  { 0x319B4EACUL, 0xC57C1A6FUL, 0x08F3,     1 },  // d7d5
+  { 0x31E58FABUL, 0xBD7DDA28UL, 0x0B7E,     1 },  // g8f6
+  { 0x341CA301UL, 0x6ABE8492UL, 0x06CB,     3 },  // d2d4
+  { 0x361F62B8UL, 0x1FBCC4C8UL, 0x048A,     1 },  // c2c3
+  { 0x3B68437BUL, 0x2701EEF3UL, 0x0AA1,     1 },  // b5c6
+  { 0x3BDA4CCDUL, 0x8D505787UL, 0x0303,     2 },  // d1e2
+  { 0x3BE15D7BUL, 0x6BB28DF0UL, 0x067D,     1 },  // f8b4
+  { 0x3E9B3CE1UL, 0x8B31FFA0UL, 0x0B7E,     1 },  // g8f6
+  { 0x3FA572B7UL, 0x6DF09D09UL, 0x091B,     1 },  // d4e5
+  { 0x40047DFEUL, 0x1A40916FUL, 0x08B2,     3 },  // c7c5
+  { 0x40047DFEUL, 0x1A40916FUL, 0x0934,     3 },  // e7e5
+  { 0x40047DFEUL, 0x1A40916FUL, 0x0AB2,     1 },  // c7c6
+  { 0x40047DFEUL, 0x1A40916FUL, 0x0B34,     1 },  // e7e6
+  { 0x439DAAF6UL, 0xDD3EF17FUL, 0x0A30,     2 },  // a7a6
+  { 0x43DA9DD8UL, 0xDD670C74UL, 0x0AF3,     2 },  // d7d6
+  { 0x43DA9DD8UL, 0xDD670C74UL, 0x0AB9,     1 },  // b8c6
+  { 0x4509DF05UL, 0xAFB36E70UL, 0x0D3D,     1 },  // f8e7
+  { 0x463CCB1BUL, 0xA20FEC93UL, 0x06A3,     2 },  // d5c4
+  { 0x48F5D53EUL, 0x01CC9810UL, 0x08F3,     1 },  // d7d5
+  { 0x4D723893UL, 0xAE0E06EDUL, 0x06CB,     1 },  // d2d4
+  { 0x520C1D8CUL, 0x7956B514UL, 0x06D5,     1 },  // f3d4
+  { 0x53018619UL, 0xBD6B2AEDUL, 0x0A7B,     1 },  // d8b6
+  { 0x53336736UL, 0xCBA3B351UL, 0x0B7E,     2 },  // g8f6
+  { 0x569206DBUL, 0xB492AEBDUL, 0x0B7E,     2 },  // g8f6
+  { 0x5E709C57UL, 0x9E5DC2C9UL, 0xC184,     1 },  // e1g1
+  { 0x5FAA4900UL, 0x22E3D3E1UL, 0x0385,     2 },  // f1g2
+  { 0x60E45089UL, 0x6572F5DFUL, 0x0546,     1 },  // g1f3
+  { 0x6240ABA5UL, 0x79687DD6UL, 0x04C5,     1 },  // f1d3
+  { 0x6311A787UL, 0x38EF6D9CUL, 0x0BA5,     1 },  // f5g6
+  { 0x6789BD5DUL, 0xAF588BD8UL, 0x08DC,     2 },  // e4d5
+  { 0x69F83223UL, 0xDC2AF7D9UL, 0x0AF3,     1 },  // d7d6
+  { 0x6E11154EUL, 0x3D172B64UL, 0x068A,     1 },  // c2c4
+  { 0x6F78159DUL, 0xB4D482A7UL, 0x0481,     1 },  // b1c3
+  { 0x701FD538UL, 0x23A5A701UL, 0xCFBC,     1 },  // e8g8
+  { 0x703F4B48UL, 0x057ED346UL, 0x0546,     1 },  // g1f3
+  { 0x720FAA83UL, 0xB4EC6645UL, 0x07CF,     1 },  // h2h4
+  { 0x727C2D71UL, 0xCD83D3F9UL, 0x0685,     2 },  // f1c4
+  { 0x727C2D71UL, 0xCD83D3F9UL, 0x06CB,     2 },  // d2d4
+  { 0x727C2D71UL, 0xCD83D3F9UL, 0x0845,     2 },  // f1b5
+  { 0x78063EA6UL, 0x634D4466UL, 0x058E,     2 },  // g2g3
+  { 0x79C24888UL, 0x584CB79CUL, 0x0AF3,     2 },  // d7d6
+  { 0x7B7EB410UL, 0x9544D9CBUL, 0x050C,     1 },  // e2e3
+  { 0x7D00E001UL, 0xF8F514D5UL, 0x0B34,     2 },  // e7e6
+  { 0x7D7BEF0AUL, 0xC7F8DD78UL, 0x0AB2,     2 },  // c7c6
+  { 0x7D7BEF0AUL, 0xC7F8DD78UL, 0x0B34,     1 },  // e7e6
+  { 0x8100EE81UL, 0xB7F8A21AUL, 0x0AB9,     2 },  // b8c6
+  { 0x8100EE81UL, 0xB7F8A21AUL, 0x0B7E,     1 },  // g8f6
+  { 0x813A770BUL, 0x35359628UL, 0x08B2,     1 },  // c7c5
+  { 0x834388B8UL, 0x7F05A2A5UL, 0x0AB9,     1 },  // b8c6
+  { 0x85897AF9UL, 0x38387534UL, 0x08F3,     1 },  // d7d5
+  { 0x88EF4D28UL, 0x512818B7UL, 0x08DA,     2 },  // c4d5
+  { 0x89148D4EUL, 0x3E9650E4UL, 0x0385,     2 },  // f1g2
+  { 0x8D95B129UL, 0x0B62CF46UL, 0x0621,     1 },  // b5a4
+  { 0x8DB332E9UL, 0xD6236817UL, 0xC184,     1 },  // e1g1
+  { 0x8F8FB2EDUL, 0xC24B06A8UL, 0x0481,     1 },  // b1c3
+  { 0x9033FA21UL, 0x1C583832UL, 0x0DBD,     2 },  // f8g7
+  { 0x90448F9DUL, 0xBA26A6EFUL, 0x059C,     1 },  // e4g3
+  { 0x948435B7UL, 0x578DE7DEUL, 0x0458,     1 },  // a4b3
+  { 0x96CA71BBUL, 0xE7CDC4AEUL, 0x0D3D,     1 },  // f8e7
+  { 0x984DB04DUL, 0x513CE103UL, 0x08B2,     1 },  // c7c5
+  { 0x98FB38EAUL, 0x4B625930UL, 0x06CB,     2 },  // d2d4
+  { 0x9AB6E705UL, 0x4D3E7804UL, 0x0B7E,     1 },  // g8f6
+  { 0x9B3A49AAUL, 0x8059A1A6UL, 0x0AB9,     2 },  // b8c6
+  { 0xA204BA5AUL, 0x8D206F83UL, 0x0546,     1 },  // g1f3
+  { 0xA23E23D0UL, 0x0FED5BB1UL, 0x0546,     7 },  // g1f3
+  { 0xA2B8A22BUL, 0x962717C2UL, 0x0546,     2 },  // g1f3
+  { 0xA33FBD1FUL, 0x3D5DFF23UL, 0x050C,     1 },  // e2e3
+  { 0xA3707047UL, 0x28848ABCUL, 0xC184,     2 },  // e1g1
+  { 0xA4602FA7UL, 0x93A9550CUL, 0x0871,     1 },  // b7b5
+  { 0xA8348B8BUL, 0x918A3D71UL, 0x0481,     1 },  // b1c3
+  { 0xA8443007UL, 0xA123CC2EUL, 0x0546,     2 },  // g1f3
+  { 0xAB3EC386UL, 0x357C2EAAUL, 0xC184,     2 },  // e1g1
+  { 0xABFC933EUL, 0x982902A8UL, 0x04A3,     2 },  // d5c3
+  { 0xAC53C769UL, 0x69C8B4D1UL, 0x0D26,     2 },  // g5e7
+  { 0xAE9E80BAUL, 0x2E9E604AUL, 0x0934,     2 },  // e7e5
+  { 0xAEABA5C0UL, 0x9E099F57UL, 0xC184,     1 },  // e1g1
+  { 0xAEB1ED66UL, 0x50511674UL, 0x091C,     2 },  // e4e5
+  { 0xB0A65E28UL, 0xA71C7D97UL, 0x06CB,     1 },  // d2d4
+  { 0xB48DB390UL, 0x5E639E7DUL, 0x072D,     1 },  // f6e4
+  { 0xB521B385UL, 0x08DEE36AUL, 0x06E2,     1 },  // c5d4
+  { 0xB5D2E692UL, 0xAFE733EEUL, 0x072D,     1 },  // f6e4
+  { 0xB5F19912UL, 0x68A85D63UL, 0x097A,     1 },  // c8f5
+  { 0xB7192B07UL, 0x3D748C37UL, 0x0408,     1 },  // a2a3
+  { 0xB73FF576UL, 0x2EE9356BUL, 0x050C,     1 },  // e2e3
+  { 0xB82A0667UL, 0x196BC53FUL, 0x0AF3,     1 },  // d7d6
+  { 0xB841463CUL, 0x18A510E3UL, 0x0385,     1 },  // f1g2
+  { 0xB8AD9D3AUL, 0x2E0E85B3UL, 0x048A,     1 },  // c2c3
+  { 0xBB737D1CUL, 0xE92918A8UL, 0x0546,     1 },  // g1f3
+  { 0xBC4A02E5UL, 0xFA3F377EUL, 0x091C,     2 },  // e4e5
+  { 0xBC52AFB3UL, 0x7D69EDBAUL, 0x0AB3,     1 },  // d7c6
+  { 0xBD4B9C2AUL, 0xC88F93ECUL, 0x0481,     2 },  // b1c3
+  { 0xC5433F38UL, 0x431CC16CUL, 0x048A,     1 },  // c2c3
+  { 0xC6765FE0UL, 0x079A590EUL, 0x06D5,     2 },  // f3d4
+  { 0xC7BB79EBUL, 0xC6F0EB83UL, 0x0EFC,     1 },  // e8d8
+  { 0xC954F4F3UL, 0x30BD385AUL, 0x068A,     2 },  // c2c4
+  { 0xCA091C4BUL, 0x49D2787EUL, 0x06A2,     1 },  // c5c4
+  { 0xCCE16C61UL, 0xE5A55095UL, 0x0546,     1 },  // g1f3
+  { 0xCE724F6FUL, 0xB954A371UL, 0x08F3,     1 },  // d7d5
+  { 0xCF46AF30UL, 0x1B9BDE90UL, 0x068A,     1 },  // c2c4
+  { 0xCF46AF30UL, 0x1B9BDE90UL, 0x0742,     1 },  // c1f4
+  { 0xCF6BA3E3UL, 0x99D70D55UL, 0x0B34,     1 },  // e7e6
+  { 0xD36A9E05UL, 0xB44BCDD6UL, 0x0105,     1 },  // f1e1
+  { 0xD8AA44BEUL, 0x2A7FF9C1UL, 0x058E,     2 },  // g2g3
+  { 0xDB6BEB8AUL, 0x8A63C71DUL, 0xCFBC,     1 },  // e8g8
+  { 0xDC2C5574UL, 0xE174288CUL, 0x0BB6,     4 },  // g7g6
+  { 0xDC2C5574UL, 0xE174288CUL, 0x0B34,     1 },  // e7e6
+  { 0xDD631035UL, 0x71A73D98UL, 0x0EC3,     1 },  // d1d8
+  { 0xE69F52A1UL, 0x6EDBF65BUL, 0x0D3D,     1 },  // f8e7
+  { 0xE8CB6F93UL, 0xAE83C427UL, 0x0B7E,     5 },  // g8f6
+  { 0xE8CB6F93UL, 0xAE83C427UL, 0x08F3,     4 },  // d7d5
+  { 0xE9FF8FCCUL, 0x0C4CB9C6UL, 0x058E,     1 },  // g2g3
+  { 0xEAE67D6EUL, 0xED93A43CUL, 0x06E2,     2 },  // c5d4
+  { 0xED4C823EUL, 0x01415ADAUL, 0x070C,    14 },  // e2e4
+  { 0xED4C823EUL, 0x01415ADAUL, 0x06CB,     5 },  // d2d4
+  { 0xED4C823EUL, 0x01415ADAUL, 0x068A,     2 },  // c2c4
+  { 0xED4C823EUL, 0x01415ADAUL, 0x0546,     1 },  // g1f3
+  { 0xEFDFA130UL, 0x5DB0A93EUL, 0x0BF7,     1 },  // h7h6
+  { 0xF089F136UL, 0xCD270365UL, 0x06CB,     1 },  // d2d4
+  { 0xF1D6A434UL, 0x3CA3AEF6UL, 0x06CB,     1 },  // d2d4
+  { 0xF369B432UL, 0x0CEC7E9FUL, 0x0AB9,     1 },  // b8c6
+  { 0xF40C4038UL, 0xA294EA44UL, 0x08ED,     2 },  // f6d5
+  { 0xF4514999UL, 0x9361300BUL, 0x0ADC,     1 },  // e4d6
+  { 0xF50E1C9BUL, 0x62E59D98UL, 0x08EB,     1 },  // d6d5
+  { 0xF64788C2UL, 0x7F6F7882UL, 0xCFBC,     2 },  // e8g8
+  { 0xF67CA875UL, 0x45FB18FCUL, 0x08F3,     2 },  // d7d5
+  { 0xF67CA875UL, 0x45FB18FCUL, 0x0DBD,     2 },  // f8g7
+  { 0xFCADC36DUL, 0x4EEC3226UL, 0x0723,     1 },  // d5e4
+  { 0xFE603A33UL, 0x2DDE7CF7UL, 0x085B,     1 },  // d4b5
+  { 0xFE8DB4CAUL, 0x34CC923DUL, 0x02C1,     1 },  // b1d2
+};
+
+const uint16_t OPENING_BOOK_SIZE = sizeof(OPENING_BOOK) / sizeof(OPENING_BOOK[0]);
@@ -0,0 +1,245 @@
+/**
+ * @file search.h
+ * @brief Computer opponent: iterative deepening alpha-beta search
+ *
+ * The search thinks on its own copy of the board, so the game board does not
+ * change while the computer is thinking. It always returns a legal move within
+ * the time budget, and every few milliseconds it gives the control back to the
+ * application through a yield function, so the web server in loop() keeps
+ * answering the clients during the search.
+ */
+
+#ifndef _SEARCH
+#define _SEARCH
+
+#include "chess_moves.h"
+
+//! Deepest ply of the search, quiescence included. It is limited on the MKR1010,
+//! where every ply uses some stack and a part of the move stack.
+#ifdef ARDUINO
+#define SEARCH_MAX_PLY 16
+#else
+#define SEARCH_MAX_PLY 64
+#endif
+
+//! Scored moves of all the plies of the searched line. The nodes keep only the
+//! moves they search, e.g. only the captures in the quiescence search; a node
+//! that does not find room is scored as a leaf.
+#ifdef ARDUINO
+#define SEARCH_MOVE_STACK 512
+#else
+#define SEARCH_MOVE_STACK 8192
+#endif
+
+// The search takes back all its moves, the undo stack of its board must not drop them
+#if UNDO_STACK_SIZE < SEARCH_MAX_PLY
+#error "UNDO_STACK_SIZE must be at least SEARCH_MAX_PLY"
+#endif
+
+//! Nodes searched between two readings of the clock
+#ifdef ARDUINO
+#define SEARCH_CLOCK_NODES 32
+#else
+#define SEARCH_CLOCK_NODES 1024
+#endif
+
+#define SCORE_INFINITE      32000   //!< Bound larger than any score
+#define SCORE_MATE          31000   //!< Score of a mate on the board, reduced by one every ply
+#define SCORE_MATE_BOUND    (SCORE_MATE - SEARCH_MAX_PLY)  //!< Lowest mate score
+#define SCORE_KNOWN_WIN     10000   //!< Bonus of an ending known to be won, e.g. by the KPK bitbase
+
+#define ORDER_HASH_MOVE     30000   //!< Ordering score of the move from the table or the previous iteration
+#define ORDER_CAPTURE       20000   //!< Lowest ordering score of the captures and promotions
+#define ORDER_KILLER        19000   //!< Ordering score of the first killer move, the second one is below
+#define HISTORY_MAX         16384   //!< Highest history score, the table is halved when it is reached
+
+//! A move with its ordering score
+struct ScoredMove {
+  Move move;
+  int16_t score;
+};
+
+/**
+ * The moves of a node with their ordering scores, a slice of the move stack
+ * of the search.
+ *
+ * The moves are picked best first by a selection that scans only the moves
+ * not yet picked, so a node ending with an early cutoff does not pay for
+ * sorting the moves it never searches.
+ */
+struct MovePicker {
+  ScoredMove* moves = NULL;       //!< The moves, on the move stack
+  int count = 0;                  //!< Number of moves
+  int next = 0;                   //!< Number of moves already picked
+
+  //! The best move not yet picked, MOVE_NONE when all the moves have been picked
+  Move pick();
+};
+
+/**
+ * Function called by the search to let the application do its work, e.g.
+ * answering the web clients. It must not change the board being searched.
+ */
+typedef void (*SearchYield)();
+
+//! How long and how deep the search can go
+struct SearchLimits {
+  unsigned long timeMs = 1000;        //!< Hard deadline, in milliseconds from the start
+  int maxDepth = SEARCH_MAX_PLY;      //!< Deepest iteration
+  unsigned long sliceMs = 20;         //!< Longest time between two calls of yield
+  SearchYield yield = NULL;           //!< Called every sliceMs, NULL if not needed
+  bool useBook = true;                //!< Play the opening book move, without searching, when there is one
+  int helper = 0;                     //!< Lazy SMP helper number, 0 for the main search (see below)
+  const bool* stop = NULL;            //!< Set by another thread to stop the search, NULL if none
+};
+
+//! Outcome of a search
+struct SearchResult {
+  Move best = MOVE_NONE;              //!< Best move found, MOVE_NONE if the game is over
+  int score = 0;                      //!< Score of the last completed iteration, for the player in turn
+  int depth = 0;                      //!< Depth of the last completed iteration
+  uint32_t nodes = 0;                 //!< Nodes searched
+  uint32_t ttProbes = 0;              //!< Transposition table lookups
+  uint32_t ttHits = 0;                //!< Lookups finding the position
+  unsigned long elapsed = 0;          //!< Time spent, in milliseconds
+};
+
+/**
+ * The Search class finds the best move of a position with an alpha-beta
+ * search deepened by one ply per iteration until the time runs out, with
+ * a quiescence search of the captures at the leaves.
+ *
+ * The object holds the board copy searched, so on the board it should be
+ * a global variable and not a local one.
+ *
+ * On the host more Search objects can think on the same position in parallel
+ * threads (Lazy SMP), sharing only the transposition table. The helpers are
+ * numbered from 1 in SearchLimits: they do not use the book nor age the table,
+ * the odd ones search one ply deeper than the main search to spread the work,
+ * and they run until the main search sets the stop flag.
+ */
+class Search {
+  //! Copy of the position searched
+  Board board;
+
+  //! Limits of the current search
+  SearchLimits limits;
+
+  //! Start time of the search and time of the last yield, in milliseconds
+  unsigned long startTime = 0;
+  unsigned long lastYield = 0;
+
+  //! Nodes searched so far
+  uint32_t nodes = 0;
+
+  //! Transposition table lookups and hits
+  uint32_t ttProbes = 0;
+  uint32_t ttHits = 0;
+
+  //! The deadline has passed, the search unwinds without using the scores
+  bool stopped = false;
+
+  //! Best move of the previous iteration, searched first
+  Move rootBest = MOVE_NONE;
+
+  //! Best root move of the current iteration, fully searched
+  Move iterationBest = MOVE_NONE;
+
+  //! Hash of the positions along the searched line, to detect repetitions
+  uint64_t path[SEARCH_MAX_PLY + 1];
+
+  //! Two quiet moves per ply that caused a cutoff, tried right after the captures
+  Move killers[SEARCH_MAX_PLY + 1][2];
+
+  //! Cutoffs of the quiet moves by color, piece and destination square, weighted by depth
+  uint16_t history[2][EMPTY][BOARD_SQUARES];
+
+  //! The moves of the nodes along the searched line, one slice per ply from the bottom
+  ScoredMove moveStack[SEARCH_MOVE_STACK];
+
+  //! First free entry of the move stack
+  int moveTop = 0;
+
+  //! All the moves of a position, before they are filtered onto the move stack
+  MoveList generated;
+
+  /**
+   * Generate the moves of the position with their ordering scores: the
+   * hash move first, then the captures by most valuable victim and least
+   * valuable attacker (MVV-LVA), the killer moves and the other quiet moves
+   * by history.
+   *
+   * The moves are pushed on the move stack; the caller gives the room back
+   * by restoring moveTop when the node returns.
+   *
+   * @param picker The moves and scores, replaced
+   * @param hashMove The move to try first, MOVE_NONE if none
+   * @param ply Distance from the root, for the killer moves
+   * @param noisyOnly If true keep only the captures and the promotions
+   *
+   * @return false if the move stack has no room for the moves
+   */
+  bool orderMoves(MovePicker& picker, Move hashMove, int ply, bool noisyOnly);
+
+  /**
+   * Remember a quiet move that caused a beta cutoff in the killer and
+   * history tables
+   *
+   * @param m The move
+   * @param depth The depth of the node
+   * @param ply Distance from the root
+   */
+  void updateOrdering(Move m, int depth, int ply);
+
+  //! Check if a move neither captures nor promotes
+  bool isQuiet(Move m);
+
+  /**
+   * Alpha-beta search
+   *
+   * @param depth Remaining depth, the quiescence search starts at 0
+   * @param ply Distance from the root
+   * @param alpha, beta The search window
+   *
+   * @return The score for the player in turn
+   */
+  int alphaBeta(int depth, int ply, int alpha, int beta);
+
+  /**
+   * Search the captures and promotions only, until the position is quiet.
+   * When in check all the moves are searched.
+   *
+   * @param ply Distance from the root
+   * @param alpha, beta The search window
+   *
+   * @return The score for the player in turn
+   */
+  int quiescence(int ply, int alpha, int beta);
+
+  //! Static score of the position for the player in turn
+  int evaluate();
+
+  //! Check if the position at ply already occurred along the searched line
+  bool isRepetition(int ply);
+
+  /**
+   * Read the clock every SEARCH_CLOCK_NODES nodes, calling the yield function
+   * when its slice has passed and stopping the search at the deadline.
+   *
+   * @return true if the search must stop
+   */
+  bool checkClock();
+
+public:
+  /**
+   * Find the best move of a position
+   *
+   * @param position The position, not changed by the search
+   * @param searchLimits Deadline, depth and yield settings
+   *
+   * @return The best move and the search statistics
+   */
+  SearchResult think(const Board& position, const SearchLimits& searchLimits);
+};
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file sliders.cpp
+ * @brief Backends of the sliding pieces attacks
+ */
+
+#include "sliders.h"
+
+//! All the squares but the A column, the landing squares of the eastward shifts
+#define NOT_A_FILE 0xFEFEFEFEFEFEFEFEULL
+//! All the squares but the H column, the landing squares of the westward shifts
+#define NOT_H_FILE 0x7F7F7F7F7F7F7F7FULL
+
+//! Shift a set by a signed number of squares, towards H8 when positive
+static inline Bitboard shiftSquares(Bitboard b, int shift) {
+  return (shift > 0) ? b << shift : b >> -shift;
+}
+
+/**
+ * Kogge-Stone occluded fill of one ray direction
+ *
+ * The slider is propagated over the empty squares doubling the distance
+ * at every step (1, 2 and 4 squares), then the filled set is shifted once more
+ * to include the first blocker.
+ *
+ * @param slider The square mask of the slider
+ * @param empty The empty squares of the board
+ * @param shift The signed square offset of the direction
+ * @param wrap Landing squares allowed for the direction (no column wrapping)
+ *
+ * @return The squares attacked along the direction
+ */
+static inline Bitboard rayAttacks(Bitboard slider, Bitboard empty, int shift, Bitboard wrap) {
+  Bitboard propagator = empty & wrap;
+
+  slider |= propagator & shiftSquares(slider, shift);
+  propagator &= shiftSquares(propagator, shift);
+  slider |= propagator & shiftSquares(slider, 2 * shift);
+  propagator &= shiftSquares(propagator, 2 * shift);
+  slider |= propagator & shiftSquares(slider, 4 * shift);
+
+  return shiftSquares(slider, shift) & wrap;
+}
+
+Bitboard koggeRookAttacks(uint8_t s, Bitboard occupied) {
+  Bitboard slider = squareMask(s);
+  Bitboard empty = ~occupied;
+
+  return rayAttacks(slider, empty, 8, ~(Bitboard)0) |
+         rayAttacks(slider, empty, -8, ~(Bitboard)0) |
+         rayAttacks(slider, empty, 1, NOT_A_FILE) |
+         rayAttacks(slider, empty, -1, NOT_H_FILE);
+}
+
+Bitboard koggeBishopAttacks(uint8_t s, Bitboard occupied) {
+  Bitboard slider = squareMask(s);
+  Bitboard empty = ~occupied;
+
+  return rayAttacks(slider, empty, 9, NOT_A_FILE) |
+         rayAttacks(slider, empty, 7, NOT_H_FILE) |
+         rayAttacks(slider, empty, -7, NOT_A_FILE) |
+         rayAttacks(slider, empty, -9, NOT_H_FILE);
+}
+
+#ifdef SLIDERS_MAGIC
+//! Size of the shared rook attack table, sum of 2^relevant bits of every square
+#define ROOK_TABLE_SIZE 0x19000
+//! Size of the shared bishop attack table
+#define BISHOP_TABLE_SIZE 0x1480
+
+SliderMagic rookMagics[BOARD_SQUARES];
+SliderMagic bishopMagics[BOARD_SQUARES];
+
+static Bitboard rookTable[ROOK_TABLE_SIZE];
+static Bitboard bishopTable[BISHOP_TABLE_SIZE];
+
+//! Deterministic xorshift generator used by the magic numbers search
+static Bitboard magicRandom(Bitboard& seed) {
+  seed ^= seed >> 12;
+  seed ^= seed << 25;
+  seed ^= seed >> 27;
+  return seed * 2685821657736338717ULL;
+}
+
+/**
+ * Find the magic numbers of a slider type and fill its attack table
+ *
+ * For every square all the subsets of the relevant occupancy are enumerated
+ * (Carry-Rippler) and mapped through random sparse candidates until one of
+ * them gives no destructive collision.
+ *
+ * @param magics The magic entries of the slider type
+ * @param table The shared attack table of the slider type
+ * @param attacks The reference attacks function
+ */
+static void initMagics(SliderMagic* magics, Bitboard* table, Bitboard (*attacks)(uint8_t, Bitboard)) {
+  static Bitboard occupancy[4096];
+  static Bitboard reference[4096];
+  static int epoch[4096];
+  const Bitboard firstRow = 0x00000000000000FFULL;
+  const Bitboard firstColumn = 0x0101010101010101ULL;
+  int attempt = 0;
+  Bitboard seed = 0x9E3779B97F4A7C15ULL;
+
+  for (int s = 0; s < BOARD_SQUARES; s++) {
+    SliderMagic& m = magics[s];
+    // The board edges never block a ray, unless the slider is on them
+    Bitboard edges = ((firstRow | firstRow << 56) & ~(firstRow << (8 * squareY(s)))) |
+                     ((firstColumn | firstColumn << 7) & ~(firstColumn << squareX(s)));
+    m.mask = attacks(s, 0) & ~edges;
+    m.shift = 64 - popCount(m.mask);
+    m.attacks = (s == 0) ? table : magics[s - 1].attacks + (1 << (64 - magics[s - 1].shift));
+
+    // Enumerate all the subsets of the mask
+    int size = 0;
+    Bitboard b = 0;
+    do {
+      occupancy[size] = b;
+      reference[size] = attacks(s, b);
+      size++;
+      b = (b - m.mask) & m.mask;
+    } while (b);
+
+    // Try sparse random numbers until all the subsets map without collisions
+    for (int i = 0; i < size; ) {
+      do {
+        m.magic = magicRandom(seed) & magicRandom(seed) & magicRandom(seed);
+      } while (popCount((m.mask * m.magic) >> 56) < 6);
+
+      attempt++;
+      for (i = 0; i < size; i++) {
+        unsigned idx = (unsigned)(((occupancy[i] & m.mask) * m.magic) >> m.shift);
+        if (epoch[idx] < attempt) {
+          epoch[idx] = attempt;
+          m.attacks[idx] = reference[i];
+        }
+        else if (m.attacks[idx] != reference[i]) {
+          break;
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+void initSliders() {
+#ifdef SLIDERS_MAGIC
+  static bool ready = false;
+
+  if (!ready) {
+    initMagics(rookMagics, rookTable, koggeRookAttacks);
+    initMagics(bishopMagics, bishopTable, koggeBishopAttacks);
+    ready = true;
+  }
+#endif
+}
@@ -0,0 +1,129 @@
+/**
+ * @file transposition.cpp
+ * @brief Bucketed transposition table with depth-preferred replacement
+ */
+
+#include "transposition.h"
+
+static_assert(sizeof(TTEntry) == 8, "A table entry must be packed in 8 bytes");
+static_assert(TT_BUCKETS > 0 && (TT_BUCKETS & (TT_BUCKETS - 1)) == 0, "TT_SIZE_BYTES must be a power of two");
+
+TranspositionTable transpositionTable;
+
+//! Bucket of a hash, selected by its lower bits
+#define TT_INDEX(hash) ((uint32_t)(hash) & (TT_BUCKETS - 1))
+
+//! Key of a hash stored in the entries
+#define TT_KEY(hash) ((uint16_t)((hash) >> 48))
+
+//! Bound type of an entry
+#define TT_BOUND(flags) ((flags) & 3)
+
+//! Generation of an entry
+#define TT_GENERATION(flags) ((flags) >> 2)
+
+// The host threads share the table: the words are read and written at once
+#ifdef ARDUINO
+#define TT_LOAD(p) (*(p))
+#define TT_STORE(p, v) (*(p) = (v))
+#else
+#define TT_LOAD(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define TT_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#endif
+
+//! Unpack an entry from its word
+static inline TTEntry loadEntry(const uint64_t* word) {
+  uint64_t w = TT_LOAD(word);
+  TTEntry entry;
+  memcpy(&entry, &w, sizeof(entry));
+  return entry;
+}
+
+//! Pack an entry in its word
+static inline void storeEntry(uint64_t* word, const TTEntry& entry) {
+  uint64_t w;
+  memcpy(&w, &entry, sizeof(w));
+  TT_STORE(word, w);
+}
+
+void TranspositionTable::clear() {
+  memset(buckets, 0, sizeof(buckets));
+  generation = 0;
+}
+
+void TranspositionTable::newSearch() {
+  TT_STORE(&generation, (uint8_t)((TT_LOAD(&generation) + 1) & 63));
+}
+
+bool TranspositionTable::probe(uint64_t hash, TTEntry& entry) {
+  TTBucket& bucket = buckets[TT_INDEX(hash)];
+  uint16_t key = TT_KEY(hash);
+
+  for (int i = 0; i < TT_BUCKET_ENTRIES; i++) {
+    TTEntry e = loadEntry(&bucket.entries[i]);
+    if (e.key == key && TT_BOUND(e.flags) != TT_BOUND_NONE) {
+      entry = e;
+      return true;
+    }
+  }
+  return false;
+}
+
+void TranspositionTable::store(uint64_t hash, Move move, int score, int depth, int bound) {
+  TTBucket& bucket = buckets[TT_INDEX(hash)];
+  uint16_t key = TT_KEY(hash);
+  uint8_t current = TT_LOAD(&generation);
+  int victim = 0;
+  int victimWorth = 0x7FFF;
+  TTEntry old = { 0, MOVE_NONE, 0, 0, TT_BOUND_NONE };
+
+  // The same position is updated in place, else the entry with the lowest depth
+  // is replaced, counting the entries of the old searches as shallower
+  for (int i = 0; i < TT_BUCKET_ENTRIES; i++) {
+    TTEntry e = loadEntry(&bucket.entries[i]);
+    if (e.key == key || TT_BOUND(e.flags) == TT_BOUND_NONE) {
+      victim = i;
+      old = e;
+      break;
+    }
+    int age = (current - TT_GENERATION(e.flags)) & 63;
+    int worth = e.depth - 8 * age;
+    if (worth < victimWorth) {
+      victimWorth = worth;
+      victim = i;
+      old = e;
+    }
+  }
+
+  // A deeper result of the same search is kept: a transposition reached later
+  // in the tree with less depth to go only refreshes its move, unless exact
+  if (old.key == key && TT_BOUND(old.flags) != TT_BOUND_NONE && TT_GENERATION(old.flags) == current &&
+      old.depth > depth && bound != TT_BOUND_EXACT) {
+    if (move != MOVE_NONE && move != old.move) {
+      old.move = move;
+      storeEntry(&bucket.entries[victim], old);
+    }
+    return;
+  }
+
+  TTEntry entry;
+  entry.key = key;
+  entry.move = (move == MOVE_NONE && old.key == key) ? old.move : move;
+  entry.score = (int16_t)score;
+  entry.depth = (uint8_t)depth;
+  entry.flags = (uint8_t)(bound | (current << 2));
+  storeEntry(&bucket.entries[victim], entry);
+}
+
+int TranspositionTable::fillPermille() const {
+  int sample = (TT_BUCKETS * TT_BUCKET_ENTRIES < TT_FILL_SAMPLE) ? TT_BUCKETS * TT_BUCKET_ENTRIES : TT_FILL_SAMPLE;
+  int used = 0;
+
+  for (int i = 0; i < sample; i++) {
+    TTEntry e = loadEntry(&buckets[i / TT_BUCKET_ENTRIES].entries[i % TT_BUCKET_ENTRIES]);
+    if (TT_BOUND(e.flags) != TT_BOUND_NONE && TT_GENERATION(e.flags) == generation) {
+      used++;
+    }
+  }
+  return used * 1000 / sample;
+}
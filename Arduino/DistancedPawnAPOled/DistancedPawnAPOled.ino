@@ -19,6 +19,8 @@
 #include "oledsettings.h"
 #include "server_params.h"
 #include "chess_moves.h"
+#include "http_parser.h"
+#include "search.h"
 
 #define PIN_R 3
 #define PIN_G 4
@@ -39,6 +41,58 @@ WiFiServer server(SERVER_PORT);
 //! Create the board object
 Board chessBoard;
 
+//! A connection of the web server and the request being received on it
+struct ServerClient {
+  WiFiClient client;            //!< The connection, false when the slot is free
+  HttpParser parser;            //!< Parser of the request, it does not use the heap
+  unsigned long lastActivity;   //!< Time of the last bytes received, or of the last answer of a deferred request (ms)
+  unsigned long requestStart;   //!< Time of the first byte of the request being received (ms)
+  bool receiving;               //!< A request has started and it is not complete yet
+  uint16_t sequence;            //!< Sequence number of the position known by a deferred request
+  char block[HTTP_READ_BLOCK];  //!< Last block read from the client
+  uint8_t blockStart;           //!< First byte of the block not parsed yet
+  uint8_t blockSize;            //!< Bytes in the block
+};
+
+//! Connections served at the same time
+ServerClient serverClients[SERVER_CLIENTS];
+
+//! Sequence number of the position, incremented by every new game and every
+//! move done: the remote board polls it to know when the board has changed
+uint16_t gameSequence = 0;
+
+//! The computer opponent. Global: it holds the board copy it searches and its move stack
+Search computer;
+
+//! The computer has been asked to move and it has not moved yet
+bool computerToMove = false;
+
+//! Set by a new game while the computer thinks: the search stops and its move is dropped
+bool computerStop = false;
+
+void serveWeb();
+void playComputer();
+void serveClient(ServerClient& slot);
+void serveDeferred(ServerClient& slot);
+void writeGameStatus(char* text, bool fen);
+void handleNewGame(Print& out, HttpParser& request);
+void handleMove(Print& out, HttpParser& request);
+void handleStatus(Print& out, HttpParser& request);
+void handleEvents(Print& out, HttpParser& request);
+void handleComputer(Print& out, HttpParser& request);
+
+//! Paths served by the web server and their handlers
+const HttpRoute ROUTES[] = {
+  { HTTPGET_NEWGAME, handleNewGame },
+  { HTTPGET_MOVE, handleMove },
+  { HTTPGET_STATUS, handleStatus },
+  { HTTPGET_EVENTS, handleEvents },
+  { HTTPGET_COMPUTER, handleComputer }
+};
+
+//! Number of served paths
+#define ROUTES_COUNT (int)(sizeof(ROUTES) / sizeof(ROUTES[0]))
+
 //! Dispaly instance
 //! Display size is not parametrized as it is specifically related
 //! to the used hardware.
@@ -127,13 +181,17 @@ void setup() {
   // start the web server on the assigned port
   server.begin();
 
+  // The book moves are chosen at random: without a seed every power-up plays
+  // the same line. The time to start the AP varies, the floating pin adds noise.
+  randomSeed(analogRead(RANDOM_SEED_PIN) ^ micros());
+
   //! System is ready
   digitalWrite(LED_BUILTIN, HIGH);               // GET /H turns the LED on
 
   printWiFiStatus();
 
   chessBoard.setBoard();
-  chessBoard.drawBoard(BOARD_SERIAL);
+  chessBoard.drawBoard(BOARD_SERIAL, &Serial1);
 
   // Initialize the display
   oled.begin(SSD1306_SWITCHCAPVCC, OLED_I2C);
@@ -154,6 +212,21 @@ void setup() {
 
 //! Main appplication function. Focused on the server activity
 void loop() {
+  serveWeb();
+
+  // The computer thinks inside loop(): the search calls serveWeb() every
+  // COMPUTER_SLICE_MS, so the clients are answered while it thinks
+  if (computerToMove) {
+    playComputer();
+  }
+}
+
+/**
+ * Serve the web clients without waiting: accept the new connections, answer
+ * the requests received and the deferred ones whose position has changed.
+ * It is called by loop() and, while the computer thinks, by the search.
+ */
+void serveWeb() {
   // compare the previous status to the current status
   if (status != WiFi.status()) {
     // it has changed update the variable
@@ -168,56 +241,394 @@ void loop() {
     }
   }
   
-  WiFiClient client = server.available();   // listen for incoming clients
-
-  if (client) {                             // if you get a client,
-    Serial1.println("new client");           // print a message out the serial port
-    String currentLine = "";                // make a String to hold incoming data from the client
-    while (client.connected()) {            // loop while the client's connected
-      if (client.available()) {             // if there's bytes to read from the client,
-        char c = client.read();             // read a byte, then
-        Serial1.write(c);                    // print it out the serial monitor
-        if (c == '\n') {                    // if the byte is a newline character
-
-          // if the current line is blank, you got two newline characters in a row.
-          // that's the end of the client HTTP request, so send a response:
-          if (currentLine.length() == 0) {
-            // HTTP headers always start with a response code (e.g. HTTP/1.1 200 OK)
-            // and a content-type so the client knows what's coming, then a blank line:
-            client.println("HTTP/1.1 200 OK");
-            client.println("Content-type:text/html");
-            client.println();
-
-            // the content of the HTTP response follows the header:
-            client.print("Click <a href=\"/H\">here</a> turn the LED on<br>");
-            client.print("Click <a href=\"/L\">here</a> turn the LED off<br>");
-
-            // The HTTP response ends with another blank line:
-            client.println();
-            // break out of the while loop:
-            break;
-          }
-          else {      // if you got a newline, then clear currentLine:
-            currentLine = "";
-          }
-        }
-        else if (c != '\r') {    // if you got anything else but a carriage return character,
-          currentLine += c;      // add it to the end of the currentLine
-        }
-
-        // Check to see if the client request was "GET /H" or "GET /L":
-//        if (currentLine.endsWith("GET /H")) {
-//          digitalWrite(led, HIGH);               // GET /H turns the LED on
-//        }
-//        if (currentLine.endsWith("GET /L")) {
-//          digitalWrite(led, LOW);                // GET /L turns the LED off
-//        }
+  // The server returns a client with bytes to read, a new one or one
+  // already served: the new clients take a free slot
+  WiFiClient client = server.available();
+  if (client) {
+    int freeSlot = -1;
+    for (int i = 0; i < SERVER_CLIENTS && client; i++) {
+      if (serverClients[i].client == client) {
+        client = WiFiClient();
+      }
+      else if (freeSlot < 0 && !serverClients[i].client) {
+        freeSlot = i;
       }
     }
-    // close the connection:
-    client.stop();
+    if (client && freeSlot >= 0) {
+      sDebug("new client");
+      serverClients[freeSlot].client = client;
+      serverClients[freeSlot].parser.begin();
+      serverClients[freeSlot].lastActivity = millis();
+      serverClients[freeSlot].receiving = false;
+      serverClients[freeSlot].blockStart = 0;
+      serverClients[freeSlot].blockSize = 0;
+    }
+    else if (client) {
+      // no slot: the client gets connected again later
+      client.stop();
+    }
+  }
+
+  // Every pass reads at most a block from each client, so a slow client
+  // does not stop the others, nor the rest of the loop
+  for (int i = 0; i < SERVER_CLIENTS; i++) {
+    serveClient(serverClients[i]);
+  }
+
+  // The requests waiting for a move are answered in the same pass of the move
+  for (int i = 0; i < SERVER_CLIENTS; i++) {
+    if (serverClients[i].client && serverClients[i].parser.isDeferred()) {
+      serveDeferred(serverClients[i]);
+    }
+  }
+}
+
+/**
+ * Serve a connection without waiting: parse the bytes it has already
+ * received, at most a block, and answer the requests they complete.
+ * The connection is closed when the client leaves, when it has been idle
+ * HTTP_KEEP_ALIVE_MS, when a request takes more than HTTP_REQUEST_MS to
+ * arrive or when the answer closes it.
+ *
+ * \param slot The connection, nothing to do if the slot is free
+ */
+void serveClient(ServerClient& slot) {
+  if (!slot.client) {
+    return;
+  }
+  if (!slot.client.connected() ||
+      (!slot.parser.isDeferred() && millis() - slot.lastActivity >= HTTP_KEEP_ALIVE_MS) ||
+      (slot.receiving && millis() - slot.requestStart >= HTTP_REQUEST_MS)) {
+    slot.client.stop();
     sDebug("client disconnected");
+    return;
+  }
+
+  // A deferred request is answered by serveDeferred(), the next one is read after it
+  if (slot.parser.isDeferred()) {
+    return;
+  }
+
+  // The bytes left in the block after a deferred request are parsed before
+  // reading the client again
+  if (slot.blockStart >= slot.blockSize) {
+    int available = slot.client.available();
+    if (available <= 0) {
+      return;
+    }
+    int size = slot.client.read((uint8_t*)slot.block,
+                                (available < HTTP_READ_BLOCK) ? available : HTTP_READ_BLOCK);
+    slot.blockStart = 0;
+    slot.blockSize = (size > 0) ? size : 0;
+    slot.lastActivity = millis();
+  }
+
+  // The requests are parsed as they arrive: when one is complete the
+  // handler of its path sends the answer, and the rest of the block
+  // starts the next request of the connection
+  while (slot.blockStart < slot.blockSize) {
+    int used;
+    if (!slot.receiving) {
+      slot.receiving = true;
+      slot.requestStart = millis();
+    }
+    int result = slot.parser.feed(slot.block + slot.blockStart, slot.blockSize - slot.blockStart, used);
+    slot.blockStart += used;
+    if (result == HTTP_PARSE_MORE) {
+      return;
+    }
+
+    slot.receiving = false;
+    bool open = slot.parser.keepAlive();
+    slot.parser.dispatch(slot.client, ROUTES, ROUTES_COUNT);
+    if (slot.parser.isDeferred()) {
+      // The handler answers when the position changes: a deferred request
+      // knows the current position, and the connection is read again after the answer
+      slot.sequence = gameSequence;
+      return;
+    }
+    if (!open) {
+      slot.client.stop();
+      sDebug("client disconnected");
+      return;
+    }
+    slot.parser.reset();
+  }
+}
+
+/**
+ * Serve a deferred request: the events stream gets an event when the
+ * position changes, and a comment after HTTP_EVENTS_HEARTBEAT_MS of silence
+ * to find the clients gone away; the long poll of the status is answered
+ * when the position changes, or after HTTP_LONG_POLL_MS with the same one.
+ *
+ * \param slot The connection waiting for the answer
+ */
+void serveDeferred(ServerClient& slot) {
+  char body[16 + FEN_SIZE];
+  bool changed = (slot.sequence != gameSequence);
+  unsigned long waited = millis() - slot.lastActivity;
+
+  if (strcmp(slot.parser.path(), HTTPGET_EVENTS) == 0) {
+    if (changed) {
+      writeGameStatus(body, false);
+      httpEvent(slot.client, body);
+    }
+    else if (waited >= HTTP_EVENTS_HEARTBEAT_MS) {
+      slot.client.print(":\n\n");
+    }
+    else {
+      return;
+    }
+    slot.sequence = gameSequence;
+    slot.lastActivity = millis();
+    return;
+  }
+
+  if (changed || waited >= HTTP_LONG_POLL_MS) {
+    bool open = slot.parser.keepAlive();
+    writeGameStatus(body, false);
+    slot.parser.respond(slot.client, 200, body);
+    if (!open) {
+      slot.client.stop();
+      sDebug("client disconnected");
+      return;
+    }
+    slot.parser.reset();
+    slot.lastActivity = millis();
+  }
+}
+
+/**
+ * The computer plays its move on the game board. The search works on its
+ * own copy of the position, so the requests served during the search see
+ * the position before the move; a new game started meanwhile stops the
+ * search and the move is dropped.
+ */
+void playComputer() {
+  SearchLimits limits;
+
+  limits.timeMs = COMPUTER_TIME_MS;
+  limits.sliceMs = COMPUTER_SLICE_MS;
+  limits.yield = serveWeb;
+  limits.stop = &computerStop;
+  computerStop = false;
+
+  SearchResult result = computer.think(chessBoard, limits);
+
+  // A new game has stopped the search, and the computer may have been asked
+  // to move again in the new game
+  if (computerStop) {
+    return;
+  }
+  computerToMove = false;
+  if (result.best != MOVE_NONE) {
+    chessBoard.makeMove(result.best);
+    gameSequence++;
+    sDebug("computer moved");
+  }
+}
+
+// =========================================================
+//                   Web server handlers
+// =========================================================
+
+/**
+ * Write the fields that start every game answer, "SSSSS C G" of server_params.h:
+ * the sequence number, the player in turn and the GAME_* status.
+ *
+ * \param text Where the fields are written, at least 10 characters
+ *
+ * \return The number of characters written
+ */
+int writeGameState(char* text) {
+  return sprintf(text, "%05u %c %d", (unsigned)gameSequence,
+                 (chessBoard.getTurn() == PLAY_WHITE) ? 'w' : 'b', chessBoard.gameStatus());
+}
+
+/**
+ * Write the answer of the status, "SSSSS C G BOARD" or "SSSSS C G FEN" of
+ * server_params.h.
+ *
+ * \param text Where the answer is written, at least 16 + FEN_SIZE characters
+ * \param fen Write the FEN of the position instead of the packed board
+ */
+void writeGameStatus(char* text, bool fen) {
+  int length = writeGameState(text);
+
+  text[length++] = ' ';
+  if (fen) {
+    chessBoard.getFen(text + length);
+  }
+  else {
+    chessBoard.getPackedBoard(text + length);
+  }
+}
+
+/**
+ * New game: the board goes back to the starting position.
+ *
+ * \param out The client connection
+ * \param request The request, without query
+ */
+void handleNewGame(Print& out, HttpParser& request) {
+  char body[16];
+
+  // A search in progress belongs to the old game
+  if (computerToMove) {
+    computerStop = true;
+    computerToMove = false;
+  }
+  chessBoard.setBoard();
+  gameSequence++;
+  writeGameState(body);
+  request.respond(out, 200, body);
+}
+
+/**
+ * Move of the remote player, e.g. "/M?e2e4", or "/M?e7e8n" to promote to
+ * a Knight; without the piece a pawn promotes to Queen. The answer starts
+ * with the MOVE_* code of chess_moves.h, MOVE_OK if the move has been done,
+ * MOVE_NOT_YOUR_TURN while the computer is thinking. A text that is not two
+ * squares and an optional promotion piece is a MOVE_GENERIC_ERROR, while
+ * MOVE_OUT_OF_BOUND is kept for the squares off the board, e.g. "e2e9".
+ *
+ * \param out The client connection
+ * \param request The request, the query is the move in coordinate notation
+ */
+void handleMove(Print& out, HttpParser& request) {
+  const char* query = request.query();
+  char body[16];
+  size_t queryLength = strlen(query);
+  // Two squares, a letter and a digit each, and the promotion piece
+  bool wellFormed = queryLength >= 4 && islower(query[0]) && isdigit(query[1]) &&
+                    islower(query[2]) && isdigit(query[3]) &&
+                    (queryLength == 4 || (queryLength == 5 && strchr("qrbn", query[4]) != NULL));
+  int from = wellFormed ? textToSquare(query) : -1;
+  int to = wellFormed ? textToSquare(query + 2) : -1;
+  Move m = chessBoard.parseMove(query);
+  int result = MOVE_OK;
+
+  if (computerToMove) {
+    m = MOVE_NONE;
+    result = MOVE_NOT_YOUR_TURN;
+  }
+  else if (m == MOVE_NONE && !wellFormed) {
+    result = MOVE_GENERIC_ERROR;
+  }
+  else if (m == MOVE_NONE && (from < 0 || to < 0)) {
+    result = MOVE_OUT_OF_BOUND;
+  }
+  // Not a legal move as written: the validation of the squares tells why,
+  // or accepts the promotion to Queen of a move without the piece. A piece
+  // that the legal move does not take, e.g. "e2e4q", is an error.
+  else if (m == MOVE_NONE) {
+    m = chessBoard.buildMove(from, to, QUEEN);
+    result = chessBoard.validate(m);
+    if (result == MOVE_OK && queryLength == 5) {
+      result = MOVE_GENERIC_ERROR;
+    }
+  }
+  if (result == MOVE_OK) {
+    chessBoard.makeMove(m);
+    gameSequence++;
+  }
+  int length = sprintf(body, "%02d ", result);
+  writeGameState(body + length);
+  request.respond(out, 200, body);
+}
+
+/**
+ * Game status: the state fields and the packed board, or the FEN with the
+ * query of HTTPGET_STATUS_FEN. With the query of HTTPGET_STATUS_TARGETS,
+ * e.g. "/S?t=e2", the legal destinations of the piece on the square as 16
+ * hexadecimal digits. With the query of HTTPGET_STATUS_SINCE, e.g.
+ * "/S?since=00012", the answer waits until the position is not the one of
+ * the sequence number; a sequence number that is not all digits is a bad
+ * request, as a wrong square.
+ *
+ * \param out The client connection
+ * \param request The request, the query is empty, "f", "since=" and the
+ * sequence number, or "t=" and the square
+ */
+void handleStatus(Print& out, HttpParser& request) {
+  const char* query = request.query();
+  // The queries follow the path and the '?'
+  const char* targets = HTTPGET_STATUS_TARGETS + sizeof(HTTPGET_STATUS);
+  const char* fen = HTTPGET_STATUS_FEN + sizeof(HTTPGET_STATUS);
+  const char* since = HTTPGET_STATUS_SINCE + sizeof(HTTPGET_STATUS);
+  char body[16 + FEN_SIZE];
+
+  if (strncmp(query, since, strlen(since)) == 0) {
+    const char* digits = query + strlen(since);
+    char* end;
+    unsigned long sequence = strtoul(digits, &end, 10);
+    if (!isdigit(*digits) || *end != '\0') {
+      request.respond(out, 400, "");
+      return;
+    }
+    if (sequence == gameSequence) {
+      request.defer();
+      return;
+    }
+  }
+
+  if (strncmp(query, targets, strlen(targets)) == 0) {
+    int s = textToSquare(query + strlen(targets));
+    if (s < 0) {
+      request.respond(out, 400, "");
+      return;
+    }
+    bitboardToText(chessBoard.legalTargets(s), body);
+    request.respond(out, 200, body);
+    return;
+  }
+
+  writeGameStatus(body, strcmp(query, fen) == 0);
+  request.respond(out, 200, body);
+}
+
+/**
+ * Server-Sent Events stream of the game: an event with the status, as the
+ * answer of HTTPGET_STATUS, now and every time the position changes.
+ *
+ * \param out The client connection
+ * \param request The request, without query
+ */
+void handleEvents(Print& out, HttpParser& request) {
+  char body[16 + FEN_SIZE];
+
+  request.respondEvents(out);
+  writeGameStatus(body, false);
+  httpEvent(out, body);
+}
+
+/**
+ * The computer plays the player in turn. The answer comes at once, with
+ * MOVE_OK when the computer starts thinking, MOVE_GAME_OVER when there is no
+ * move to play or MOVE_NOT_YOUR_TURN when it is already thinking; the move is
+ * done within COMPUTER_TIME_MS and it changes the sequence number, as a move
+ * of the remote player.
+ *
+ * \param out The client connection
+ * \param request The request, without query
+ */
+void handleComputer(Print& out, HttpParser& request) {
+  char body[16];
+  int result = MOVE_OK;
+
+  if (computerToMove) {
+    result = MOVE_NOT_YOUR_TURN;
+  }
+  else if (chessBoard.isGameOver()) {
+    result = MOVE_GAME_OVER;
+  }
+  else {
+    computerToMove = true;
   }
+  int length = sprintf(body, "%02d ", result);
+  writeGameState(body + length);
+  request.respond(out, 200, body);
 }
 
 //! Debug onlly
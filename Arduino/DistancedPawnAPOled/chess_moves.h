@@ -15,6 +15,10 @@
 
 #include <Streaming.h>
 
+#include <string.h>
+
+#include "bitboard.h"
+
 //! If TERMINAL_MODE is defined the game is emulated on the serial
 //! terminal and html remote web instead of the display
 #define TERMINAL_MODE
@@ -34,6 +38,9 @@
 #define ERR_BISHOP              "Wrong bishop move"
 #define ERR_QUEEN               "Wrong queen move"
 #define ERR_KING                "Wrong king move"
+#define ERR_NOT_YOUR_TURN       "It is not your turn"
+#define ERR_KING_IN_CHECK       "Invalid move: your King would be in check"
+#define ERR_GAME_OVER           "The game is over"
 
 #define MOVE_OK                 0   //!< Correct move
 #define MOVE_OUT_OF_BOUND       1   //!< Move out of bound
@@ -46,25 +53,56 @@
 #define MOVE_BISHOP_INVALID     8   //!< Invalid bishop move
 #define MOVE_QUEEN_INVALID      9   //!< Invalid queen move
 #define MOVE_KING_INVALID      10   //!< Invalid king move
+#define MOVE_NOT_YOUR_TURN     11   //!< The piece on the from coordinates belongs to the other player
+#define MOVE_KING_IN_CHECK     12   //!< The move leaves the King of the player under attack
+#define MOVE_GAME_OVER         13   //!< The game is ended by checkmate or stalemate
+
+#define GAME_PLAYING            0   //!< The player in turn can move and is not in check
+#define GAME_CHECK              1   //!< The player in turn is in check and can defend
+#define GAME_CHECKMATE          2   //!< The player in turn is checkmated and lost the game
+#define GAME_STALEMATE          3   //!< The player in turn cannot move and is not in check, the game is drawn
+
+//! Longest FEN written by Board::getFen(), terminator included
+#define FEN_SIZE               92
+//! Length of the board written by Board::getPackedBoard(), terminator included
+#define PACKED_BOARD_SIZE      65
 
 //! Definition of the pieces, including the empty square
 enum ChessPiece { KING, QUEEN, BISHOP, KNIGHT, ROOK, PAWN, EMPTY };
 //! Definition of the player color. Color type NONE is for an empy square
 enum ChessColor { PLAY_WHITE, PLAY_BLACK, PLAY_NONE };
 
+/**
+ * One byte code of a piece with its color: the ChessPiece in the lower three
+ * bits and the ChessColor in the upper ones. An empty square is NO_PIECE.
+ */
+typedef uint8_t PieceCode;
+
+//! Code of an empty square
+#define NO_PIECE ((PieceCode)EMPTY)
+
+//! Code of a piece of the given color
+inline PieceCode pieceCode(ChessPiece p, ChessColor c) {
+  return (p == EMPTY || c == PLAY_NONE) ? NO_PIECE : (PieceCode)((c << 3) | p);
+}
+
+//! Piece type of a piece code
+inline ChessPiece codePiece(PieceCode pc) { return (ChessPiece)(pc & 7); }
+
+//! Color of a piece code, PLAY_NONE for an empty square
+inline ChessColor codeColor(PieceCode pc) { return (pc == NO_PIECE) ? PLAY_NONE : (ChessColor)(pc >> 3); }
+
 /**
  * Square is the class that manages the single square with the piece
- * on it, if any. This class is controlled by the class Board
+ * on it, if any. The board does not store Square objects: they are views
+ * built by the class Board on the fly from its bitboards.
  */
 class Square {
-  //! Pieces enumerator type
-  ChessPiece piece;
-  
-  //! Player color anumerator type
-  ChessColor color;
-  
-  //! Chessboard square coordinates
-  int x, y;
+  //! Piece and color on the square
+  PieceCode code;
+
+  //! Square index on the board, the coordinates are derived from it
+  uint8_t index;
 
 public:
   //! Represent a square of the board with the right color
@@ -87,109 +125,450 @@ public:
   ChessColor getPieceColor();
   
   //! Set the desired x coordinate
-  void setX(int ex) { x = ex; }
+  void setX(int ex) { index = squareAt(ex, squareY(index)); }
   
   //! Set the desired y coordinate
-  void setY(int why) { y = why; }
+  void setY(int why) { index = squareAt(squareX(index), why); }
   
   //! Get the desired x coordinate
-  int getX() { return x; }
+  int getX() { return squareX(index); }
   
   //! Get the desired y coordinate
-  int getY() { return y; }
+  int getY() { return squareY(index); }
   
   //! The Square class constructor initializes the square to empy with no color
   Square();
+
+  /**
+   * Build the view of a board square
+   *
+   * @param p, c Piece and color on the square
+   * @param ex, why The square coordinates
+   */
+  Square(ChessPiece p, ChessColor c, int ex, int why);
+};
+
+/**
+ * A move packed in 16 bits:
+ * <ul>
+ * <li>bits 0-5: square index of the moved piece
+ * <li>bits 6-11: square index where the piece lands
+ * <li>bits 12-13: promotion piece, counted from QUEEN (queen, bishop, knight, rook)
+ * <li>bits 14-15: one of the MOVE_FLAG_* special move types
+ * </ul>
+ * The value MOVE_NONE (A1 to A1) is never a valid move.
+ */
+typedef uint16_t Move;
+
+#define MOVE_NONE              0   //!< No move
+#define MOVE_FLAG_NORMAL       0   //!< Normal move or capture
+#define MOVE_FLAG_PROMOTION    1   //!< Pawn promotion
+#define MOVE_FLAG_EN_PASSANT   2   //!< En passant capture
+#define MOVE_FLAG_CASTLING     3   //!< Castling, stored as the King move
+
+/**
+ * Pack a move
+ *
+ * @param from, to The square indexes of the move
+ * @param flags One of the MOVE_FLAG_* types
+ * @param promotion The promotion piece, QUEEN to ROOK, used with MOVE_FLAG_PROMOTION
+ *
+ * @return The packed move
+ */
+inline Move packMove(uint8_t from, uint8_t to, int flags = MOVE_FLAG_NORMAL, ChessPiece promotion = QUEEN) {
+  return (Move)(from | (to << 6) | ((promotion - QUEEN) << 12) | (flags << 14));
+}
+
+//! Square index of the moved piece
+inline uint8_t moveFrom(Move m) { return m & 63; }
+
+//! Square index where the piece lands
+inline uint8_t moveTo(Move m) { return (m >> 6) & 63; }
+
+//! Special move type, one of the MOVE_FLAG_*
+inline int moveFlags(Move m) { return m >> 14; }
+
+//! Promotion piece of a MOVE_FLAG_PROMOTION move
+inline ChessPiece movePromotion(Move m) { return (ChessPiece)(QUEEN + ((m >> 12) & 3)); }
+
+/**
+ * Write a move in the coordinate notation used by the network messages
+ * (e.g. "e2e4", or "e7e8q" for a promotion)
+ *
+ * @param m The move
+ * @param text The destination buffer, at least 6 characters
+ */
+void moveToText(Move m, char* text);
+
+/**
+ * Read a square written in coordinate notation (e.g. "e2")
+ *
+ * @param text The square text, only the first two characters are used
+ *
+ * @return The square index, or -1 if the text is not a square
+ */
+int textToSquare(const char* text);
+
+/**
+ * Write a set of squares as 16 hexadecimal digits, most significant first
+ * (bit 0 is A1), as answered to the network status requests
+ *
+ * @param b The set of squares
+ * @param text The destination buffer, at least 17 characters
+ */
+void bitboardToText(Bitboard b, char* text);
+
+//! Maximum number of moves in a position (the largest known is 218)
+#define MAX_MOVES 220
+
+/**
+ * Fixed capacity list of moves filled by the move generator.
+ *
+ * The list does not use the heap and it is meant to be declared as a local
+ * variable of the caller.
+ */
+struct MoveList {
+  Move moves[MAX_MOVES];  //!< The generated moves
+  int count = 0;          //!< Number of valid entries of moves
+
+  //! Append a move to the list
+  void add(Move m) { moves[count++] = m; }
+};
+
+#define CASTLE_WHITE_KING      1   //!< White can castle on the King side
+#define CASTLE_WHITE_QUEEN     2   //!< White can castle on the Queen side
+#define CASTLE_BLACK_KING      4   //!< Black can castle on the King side
+#define CASTLE_BLACK_QUEEN     8   //!< Black can castle on the Queen side
+
+//! En passant file of a position where no en passant capture is possible
+#define NO_EN_PASSANT          8
+
+/**
+ * The state of a position that cannot be recalculated when a move is taken
+ * back, packed in 32 bits:
+ * <ul>
+ * <li>bits 0-3: the CASTLE_* rights still available
+ * <li>bits 4-7: file of the pawn that can be captured en passant, or NO_EN_PASSANT
+ * <li>bits 8-15: halfmoves since the last capture or pawn move (fifty-move rule)
+ * <li>bits 16-31: number of the full move, starting from 1
+ * </ul>
+ */
+typedef uint32_t GameState;
+
+/**
+ * Pack a game state
+ *
+ * @param castling The CASTLE_* rights
+ * @param epFile The en passant file, or NO_EN_PASSANT
+ * @param halfmoves The halfmove clock, saturated at 255
+ * @param fullmoves The full move number
+ *
+ * @return The packed state
+ */
+inline GameState packState(int castling, int epFile, int halfmoves, int fullmoves) {
+  return (GameState)castling | ((GameState)epFile << 4) |
+         ((GameState)(halfmoves < 255 ? halfmoves : 255) << 8) | ((GameState)fullmoves << 16);
+}
+
+//! Castling rights of a game state
+inline int stateCastling(GameState gs) { return gs & 15; }
+
+//! En passant file of a game state, NO_EN_PASSANT if none
+inline int stateEpFile(GameState gs) { return (gs >> 4) & 15; }
+
+//! Halfmove clock of a game state
+inline int stateHalfmoves(GameState gs) { return (gs >> 8) & 255; }
+
+//! Full move number of a game state
+inline int stateFullmoves(GameState gs) { return gs >> 16; }
+
+//! Number of moves kept by the undo stack. Older moves are dropped when it is full.
+//! On the MKR1010 it is sized for the search, that takes back all its moves; every
+//! board copy of the search carries it.
+#ifdef ARDUINO
+#define UNDO_STACK_SIZE 32
+#else
+#define UNDO_STACK_SIZE 1024
+#endif
+
+//! What makeMove() changes and cannot be recalculated when the move is taken back
+struct UndoInfo {
+  uint64_t hash;        //!< Zobrist hash of the position before the move
+  GameState state;      //!< Castling, en passant and counters before the move
+  Move move;            //!< The move done
+  PieceCode captured;   //!< Piece captured by the move, NO_PIECE if none
 };
 
 /**
- * The Board class defines the board in a 8x8 two-dimensions array and manage
- * the pieces moves
+ * The Board class defines the board as a set of bitboards, one 64-bit occupancy
+ * word for every piece type and for every player color, and manage the pieces moves
  */
 class Board {
-  //! Definition of the two-dimensions array representing the board
-  Square square[8][8];
+  //! Occupancy of every piece type, indexed by ChessPiece (KING to PAWN)
+  Bitboard pieces[EMPTY] = { };
+
+  //! Occupancy of every player, indexed by ChessColor (PLAY_WHITE and PLAY_BLACK)
+  Bitboard colors[PLAY_NONE] = { };
+
+  //! Piece code on every square, to find the piece on a square without scanning the bitboards
+  PieceCode mailbox[BOARD_SQUARES];
   
   //! Current player turn. Start with white always
   ChessColor turn = PLAY_WHITE;
 
+  //! Opponent pieces giving check to the King of the player in turn
+  Bitboard checkers = 0;
+
+  //! Pieces of the player in turn that cannot leave the line to their King
+  Bitboard pinned = 0;
+
+  //! Castling rights, en passant file and move counters of the position
+  GameState state = packState(0, NO_EN_PASSANT, 0, 1);
+
+  //! Zobrist hash of the position, updated by every piece, turn and state change
+  uint64_t hash = 0;
+
+  //! Midgame and endgame piece-square scores of all the pieces, positive for white
+  int16_t scoreMg = 0;
+  int16_t scoreEg = 0;
+
+  //! Game phase from the pieces on the board, PHASE_MAX at the start of the game
+  uint8_t phase = 0;
+
+  //! Undo stack of the moves done, used as a ring buffer
+  UndoInfo history[UNDO_STACK_SIZE];
+
+  //! Index of the next free entry of the undo stack
+  uint16_t historyTop = 0;
+
+  //! Number of moves that can be taken back
+  uint16_t historyCount = 0;
+
+  //! Cached GAME_* status of the position, negative when not yet calculated
+  mutable int8_t status = -1;
+
+  //! Cached legal destinations of the piece on every square of the position with
+  //! hash targetsHash. One table serves all the boards: only the game board asks
+  //! for the targets, and the search copies do not carry 512 bytes each.
+  static Bitboard targets[BOARD_SQUARES];
+  static uint64_t targetsHash;
+  static bool targetsReady;
+
+  /**
+   * Update the checkers and the pinned pieces of the player in turn.
+   *
+   * It is called every time the position changes, so the check and
+   * game status queries do not need to scan the board.
+   */
+  void updateCheckInfo();
+
+  /**
+   * Validate a move of the player in turn without changing the board
+   *
+   * @param m The move
+   * @param dangers The squares attacked by the opponent as by kingDangers(),
+   * or NULL to check the King moves one by one
+   *
+   * @return One of the move statuses
+   */
+  int validateMove(Move m, const Bitboard* dangers) const;
+
+  /**
+   * Squares attacked by the opponent, with the King of the player in turn
+   * removed from the board so that it cannot hide behind itself from a slider.
+   *
+   * @return The squares where the King of the player in turn cannot go
+   */
+  Bitboard kingDangers() const;
+
+  /**
+   * Replace the castling rights and the en passant file, updating the hash
+   *
+   * @param castling The CASTLE_* rights
+   * @param epFile The file of the pawn just pushed by two squares, or NO_EN_PASSANT.
+   * It is kept only if a pawn of the player in turn can capture it.
+   * @param halfmoves, fullmoves The move counters
+   */
+  void setState(int castling, int epFile, int halfmoves, int fullmoves);
+
+  /**
+   * Castling rights allowed by the position of the pieces
+   *
+   * @param castling The CASTLE_* rights requested
+   *
+   * @return The rights whose King and Rook are still on their start squares
+   */
+  int validCastling(int castling) const;
+
+  /**
+   * Check the castling conditions of the King of the player in turn, but
+   * for the destination square being under attack
+   *
+   * @param from, to The King square and its castling destination
+   *
+   * @return MOVE_OK or the reason why the castling is not allowed
+   */
+  int checkCastling(uint8_t from, uint8_t to) const;
+
+  //! Check if the player in turn has at least one legal move
+  bool hasLegalMove() const;
+
+  //! Empty all the squares and reset the game state
+  void clearBoard();
+
+  //! All the occupied squares of the board
+  Bitboard occupied() const { return colors[PLAY_WHITE] | colors[PLAY_BLACK]; }
+
+  /**
+   * Piece on a square
+   *
+   * @param s The square index
+   *
+   * @return The piece type or EMPTY
+   */
+  ChessPiece pieceOn(uint8_t s) const { return codePiece(mailbox[s]); }
+
+  /**
+   * Color of the piece on a square
+   *
+   * @param s The square index
+   *
+   * @return The piece color or PLAY_NONE
+   */
+  ChessColor colorOn(uint8_t s) const { return codeColor(mailbox[s]); }
+
+  /**
+   * Place a piece on a square, replacing whatever was there
+   *
+   * @param s The square index
+   * @param p, c The piece and its color. EMPTY or PLAY_NONE empty the square
+   */
+  void putPiece(uint8_t s, ChessPiece p, ChessColor c);
+
+  /**
+   * Add or remove the scores of a piece on a square from the evaluation sums
+   *
+   * @param pc The piece code, not NO_PIECE
+   * @param s The square index
+   * @param sign 1 to add the piece, -1 to remove it
+   */
+  void scorePiece(PieceCode pc, uint8_t s, int sign);
+
+  /**
+   * Move the piece from a square to another, capturing what is on the destination
+   *
+   * @param from, to The square indexes
+   */
+  void movePiece(uint8_t from, uint8_t to);
+
+  /**
+   * Add a move to the list for every destination square
+   *
+   * @param list The move list
+   * @param from The square index of the moved piece
+   * @param targets The destination squares
+   */
+  void addMoves(MoveList& list, uint8_t from, Bitboard targets) const;
+
+  /**
+   * Add the moves of a pawn to the list, with the promotions to every piece
+   * and the en passant flag
+   *
+   * @param list The move list
+   * @param from The square index of the pawn
+   * @param targets The destination squares
+   */
+  void addPawnMoves(MoveList& list, uint8_t from, Bitboard targets) const;
+
+  /**
+   * Check that a move of the player in turn does not leave its king under attack.
+   *
+   * The moves of the other pieces are decided by the checkers and pinned
+   * masks alone; the King moves are evaluated on the occupancy after the
+   * move, without changing the board.
+   *
+   * @param from, to The square indexes of the move
+   *
+   * @return true if the king is not attacked after the move
+   */
+  bool leavesKingSafe(uint8_t from, uint8_t to) const;
+
+  /**
+   * Same as leavesKingSafe(from, to) with the King moves checked against an
+   * attack map calculated once for all the moves of the position
+   *
+   * @param from, to The square indexes of the move
+   * @param dangers The squares attacked by the opponent, as by kingDangers()
+   *
+   * @return true if the king is not attacked after the move
+   */
+  bool leavesKingSafe(uint8_t from, uint8_t to, Bitboard dangers) const;
+
   /**
-   * Check for the Kingueen rule and makes the move
+   * Check for the King rule
    * 
-   * @param thisKing Pointer to the Square object with the King
-   * @param thatSpace Pinter to the Square object where move the Piece
+   * @param from Square index of the King
+   * @param to Square index where move the Piece
    * 
    * @return If the move is valid according to the piece rules returns MOVE_OK
    * else return the wrong rule error
    */
-  int moveKing(Square* thisKing, Square* thatSpace);
+  int moveKing(uint8_t from, uint8_t to) const;
   
   /**
-   * Check for the Queen rule and makes the move
+   * Check for the Queen rule
    * 
-   * @param thisQueen Pointer to the Square object with the Queen
-   * @param thatSpace Pinter to the Square object where move the Piece
+   * @param from Square index of the Queen
+   * @param to Square index where move the Piece
    * 
    * @return If the move is valid according to the piece rules returns MOVE_OK
    * else return the wrong rule error
    */
-  int moveQueen(Square* thisQueen, Square* thatSpace);
+  int moveQueen(uint8_t from, uint8_t to) const;
   
   /**
-   * Check for the Bishop rule and makes the move
+   * Check for the Bishop rule
    * 
-   * @param thisBishop Pointer to the Square object with the Bishop
-   * @param thatSpace Pinter to the Square object where move the Piece
+   * @param from Square index of the Bishop
+   * @param to Square index where move the Piece
    * 
    * @return If the move is valid according to the piece rules returns MOVE_OK
    * else return the wrong rule error
    */
-  int moveBishop(Square* thisBishop, Square* thatSpace);
+  int moveBishop(uint8_t from, uint8_t to) const;
   
   /**
-   * Check for the Knight rule and makes the move
+   * Check for the Knight rule
    * 
-   * @param thisRook Pointer to the Square object with the Knight
-   * @param thatSpace Pinter to the Square object where move the Piece
+   * @param from Square index of the Knight
+   * @param to Square index where move the Piece
    * 
    * @return If the move is valid according to the piece rules returns MOVE_OK
    * else return the wrong rule error
    */
-  int moveKnight(Square* thisKnight, Square* thatSpace);
+  int moveKnight(uint8_t from, uint8_t to) const;
   
   /**
-   * Check for the Rook rule and makes the move
+   * Check for the Rook rule
    * 
-   * @param thisRook Pointer to the Square object with the Rook
-   * @param thatSpace Pinter to the Square object where move the Piece
+   * @param from Square index of the Rook
+   * @param to Square index where move the Piece
    * 
    * @return If the move is valid according to the piece rules returns MOVE_OK
    * else return the wrong rule error
    */
-  int moveRook(Square* thisRook, Square* thatSpace);
+  int moveRook(uint8_t from, uint8_t to) const;
   
   /**
-   * Check for the Pawn rule and makes the move
+   * Check for the Pawn rule
    * 
-   * @param thisPawn Pointer to the Square object with the Pawn
-   * @param thatSpace Pinter to the Square object where move the Piece
+   * @param from Square index of the Pawn
+   * @param to Square index where move the Piece
    * 
    * @return If the move is valid according to the piece rules returns MOVE_OK
    * else return the wrong rule error
    */
-  int movePawn(Square* thisPawn, Square* thatSpace);
-  
-  /** 
-   * Executes the move on the board checking for vaidity.
-   * 
-   * It is expected that this method is called after checking for turns
-   * 
-   * @params x1, y1 Start coordinates of the move
-   * @params x2, y2 Destination coordinates of the move
-   * 
-   * @return One of the move statuses
-   */
-  int makeMove(int x1, int y1, int x2, int y2);
+  int movePawn(uint8_t from, uint8_t to) const;
   
   /** 
    * Draw the board on the display of the controller. 
@@ -215,16 +594,21 @@ class Board {
    * 
    * When the game is played by only one side, the local player can play with the serial
    * terminal while the remote will play from the browser.
+   *
+   * @param out The serial port where the board is printed
    */
-  void drawSerialBoard();
+  void drawSerialBoard(Print* out);
 
 public:
+  //! The Board class constructor initializes an empty board
+  Board();
+
   /** 
-   * Pointer to the Square class at the specific board coordinates 
+   * View of the square at the specific board coordinates 
    * 
    * @params x, y coordinates of the square
    */
-  Square* getSquare(int x, int y) { return &square[x][y]; }
+  Square getSquare(int x, int y);
 
   /**
    * Set the square at the desired position
@@ -232,14 +616,252 @@ public:
    * @param s Pointer to the Square class
    * @param x, y The square coordinates on the board
    */
-  void setSquare(Square * s, int x, int y) { square[x][y]=*s; }
+  void setSquare(Square * s, int x, int y) {
+    putPiece(squareAt(x, y), s->getPiece(), s->getPieceColor());
+    setState(validCastling(stateCastling(state)), stateEpFile(state), stateHalfmoves(state), stateFullmoves(state));
+    updateCheckInfo();
+  }
+
+  /** 
+   * Executes the move on the board checking for vaidity.
+   * 
+   * Only the player in turn can move, and after a valid move the turn
+   * passes to the opponent. The move is checked by validate() and the
+   * board changes only if it is legal. Castling is the King moving by two
+   * squares, and a pawn reaching the last row is promoted to Queen.
+   * 
+   * @params x1, y1 Start coordinates of the move
+   * @params x2, y2 Destination coordinates of the move
+   * 
+   * @return One of the move statuses
+   */
+  int makeMove(int x1, int y1, int x2, int y2);
+
+  /**
+   * Build the move of a piece between two squares, with the special move flag
+   * deduced from the position: a King moving by two squares castles, a pawn
+   * reaching the last row promotes and a pawn landing on the en passant square
+   * captures en passant.
+   *
+   * @param from, to The square indexes of the move
+   * @param promotion The promotion piece used if the move is a promotion
+   *
+   * @return The move
+   */
+  Move buildMove(uint8_t from, uint8_t to, ChessPiece promotion) const;
+
+  /**
+   * Check if a move of the player in turn is legal, without changing the board
+   *
+   * @param m The move
+   *
+   * @return MOVE_OK if the move can be done else the reason why it cannot
+   */
+  int validate(Move m) const;
+
+  /**
+   * Validate many candidate moves of the same position at once.
+   *
+   * The work shared by all the moves, like the game status and the squares
+   * attacked by the opponent, is done only once for the whole batch.
+   *
+   * @param moves The moves to validate
+   * @param results The validate() result of every move, same size as moves
+   * @param count Number of moves
+   */
+  void validateBatch(const Move* moves, uint8_t* results, int count) const;
+  
+  /**
+   * Execute a legal move, as listed by generateMoves() or accepted by
+   * validate(), without validating it again.
+   *
+   * The captured piece and the hash are saved on the undo stack, so the move
+   * can be taken back by unmakeMove() without copying the board.
+   *
+   * @param m The move
+   */
+  void makeMove(Move m);
+
+  /**
+   * Find the legal move written in coordinate notation, as by moveToText()
+   *
+   * @param text The move text, e.g. "e2e4"
+   *
+   * @return The legal move, or MOVE_NONE if the text is not a legal move
+   */
+  Move parseMove(const char* text);
+
+  /**
+   * Take back the last move done
+   *
+   * @return false if there are no moves to take back
+   */
+  bool unmakeMove();
+
+  //! Number of moves that can be taken back
+  int undoCount() const { return historyCount; }
+
+  //! Player who moves next
+  ChessColor getTurn() const { return turn; }
+
+  //! Squares of the pieces of a type and color
+  Bitboard getPieces(ChessPiece p, ChessColor c) const { return pieces[p] & colors[c]; }
+
+  //! Squares of all the pieces on the board
+  Bitboard getOccupied() const { return occupied(); }
+
+  //! Piece code on a square, NO_PIECE if it is empty
+  PieceCode getPieceCode(uint8_t s) const { return mailbox[s]; }
+
+  //! Castling rights, en passant file and move counters of the position
+  GameState getState() const { return state; }
+
+  //! Square where a pawn can capture en passant, -1 if none
+  int getEpSquare() const {
+    return (stateEpFile(state) == NO_EN_PASSANT) ? -1 : squareAt(stateEpFile(state), turn == PLAY_WHITE ? 5 : 2);
+  }
+
+  //! Zobrist hash of the position, kept up to date move by move
+  uint64_t getHash() const { return hash; }
+
+  /**
+   * Calculate the Zobrist hash of the position from scratch.
+   *
+   * It is the reference of the incremental hash and it is used only
+   * to verify it.
+   *
+   * @return The hash of the pieces on the board, of the player in turn, of the
+   * castling rights and of the en passant file
+   */
+  uint64_t computeHash() const;
+
+  /**
+   * Static evaluation of the position: the midgame and endgame scores of the
+   * pieces kept up to date move by move, blended by the game phase
+   *
+   * @return The score in centipawns for the player in turn
+   */
+  int evaluate() const;
+
+  /**
+   * Calculate the static evaluation from scratch.
+   *
+   * It is the reference of the incremental evaluation and it is used only
+   * to verify it.
+   *
+   * @return The score in centipawns for the player in turn
+   */
+  int computeEvaluation() const;
+
+  //! Check if the King of the player in turn is under attack
+  bool inCheck() const { return checkers != 0; }
+
+  //! Opponent pieces giving check to the player in turn
+  Bitboard getCheckers() const { return checkers; }
+
+  //! Pieces of the player in turn pinned to their King
+  Bitboard getPinned() const { return pinned; }
+
+  /**
+   * Status of the game in the current position.
+   *
+   * The status is calculated at most once per position: the result is kept
+   * until the next move, so it can be polled at every request.
+   *
+   * @return One of the GAME_* statuses
+   */
+  int gameStatus() const;
+
+  //! Check if the game is ended by checkmate or stalemate
+  bool isGameOver() const { return gameStatus() >= GAME_CHECKMATE; }
+
+  /**
+   * Legal destinations of the piece on a square, to highlight them when the
+   * piece is picked up.
+   *
+   * The destinations of all the squares are calculated together on the first
+   * request in a position and kept until another position asks for them, so
+   * the following requests are a single table read. The table is shared by
+   * all the boards, so the calls cannot be made from different threads.
+   *
+   * @param s The square index
+   *
+   * @return The squares where the piece can move, empty if the square has no
+   * piece of the player in turn
+   */
+  Bitboard legalTargets(uint8_t s) const;
+
+  /**
+   * All the pieces of both colors attacking a square
+   *
+   * @param s The square index
+   * @param occupancy The occupied squares used to stop the sliding pieces
+   *
+   * @return The squares of the attacking pieces
+   */
+  Bitboard attackersTo(uint8_t s, Bitboard occupancy) const;
+
+  /**
+   * List the moves of the player in turn following the piece rules, without
+   * checking if the king is left under attack.
+   *
+   * @param list The move list, replaced by the generated moves
+   * @param targets Only the moves landing on these squares are listed; an
+   * en passant capture lands on the square of the captured pawn
+   */
+  void generatePseudoLegalMoves(MoveList& list, Bitboard targets = ~(Bitboard)0) const;
+
+  /**
+   * List the legal moves of the player in turn
+   *
+   * @param list The move list, replaced by the generated moves
+   * @param targets Only the moves landing on these squares are listed, as
+   * in generatePseudoLegalMoves(), e.g. noisyTargets()
+   */
+  void generateMoves(MoveList& list, Bitboard targets = ~(Bitboard)0) const;
+
+  //! Target squares of the captures and of the promotions of the player in turn
+  Bitboard noisyTargets() const {
+    return colors[turn ^ 1] | ((turn == PLAY_WHITE) ? 0xFF00000000000000ULL : 0xFFULL);
+  }
 
   //! Check for a valid move and executes it
   bool doMove();
   
-  //! Initializes the board bi-dimensional array to the start of game
+  //! Initializes the board to the start of game
   void setBoard();
 
+  /**
+   * Set up the position described by a FEN string.
+   *
+   * The castling, en passant and move counters fields are optional; when
+   * missing there are no castling rights nor en passant captures and the
+   * counters start from the beginning.
+   *
+   * @param fen The position in Forsyth-Edwards Notation
+   *
+   * @return false if the pieces placement is not valid, leaving the board empty
+   */
+  bool setFen(const char* fen);
+
+  /**
+   * Write the position in Forsyth-Edwards Notation, the format read by setFen().
+   * The en passant square is written only when a pawn can capture on it.
+   *
+   * @param text Where the FEN is written, at least FEN_SIZE characters
+   *
+   * @return The length of the FEN
+   */
+  int getFen(char* text) const;
+
+  /**
+   * Write the pieces as 64 characters from A1 to H8, bit order of the
+   * bitboards: the FEN letters, uppercase for white, and '.' for the empty squares
+   *
+   * @param text Where the board is written, at least PACKED_BOARD_SIZE characters
+   */
+  void getPackedBoard(char* text) const;
+
   //! Play a game
   bool playGame();
 
@@ -248,8 +870,9 @@ public:
    * output type (serial, web page, display)
    * 
    * @param int t The kind of desired output
+   * @param out The serial port used by the BOARD_SERIAL output
    */
-  void drawBoard(int t);
+  void drawBoard(int t, Print* out);
 };
 
 #endif
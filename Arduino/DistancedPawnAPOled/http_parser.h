@@ -0,0 +1,226 @@
+/**
+ * @file http_parser.h
+ * @brief Incremental HTTP request parser and router of the web server
+ *
+ * The request is read one byte at a time, or in blocks of the bytes the WiFi
+ * client has received, by a state machine that keeps only the request target
+ * (path and query) in a fixed buffer and skips the headers. There is no String
+ * and no heap: a parser is a few dozen bytes of static memory, so the loop of
+ * the server does not fragment the heap of the MKR1010 request after request.
+ *
+ * When the request is complete the path selects the handler in a table of
+ * routes, e.g. HTTPGET_NEWGAME, HTTPGET_MOVE and HTTPGET_STATUS of
+ * server_params.h, and the handler writes the answer.
+ *
+ * The connections are persistent as in HTTP/1.1: the answers have a
+ * Content-Length, so the client reads the next answer on the same connection
+ * without a new TCP handshake through the WiFi module. The Connection header
+ * of the request is read, and the server closes the connection after a
+ * number of requests or some idle time.
+ *
+ * A handler can also answer later, e.g. when the position changes: it defers
+ * the request, that stays in the parser until the server answers it. The
+ * Server-Sent Events streams are deferred requests that are never answered,
+ * the server writes the events on the connection as they happen.
+ */
+
+#ifndef _HTTP_PARSER
+#define _HTTP_PARSER
+
+#include <Arduino.h>
+#include <stdint.h>
+
+//! Longest request target kept, terminator included; longer targets get 414
+#define HTTP_TARGET_SIZE 48
+
+//! Bytes read from the client at once: every read is a SPI transaction with the WiFi module
+#define HTTP_READ_BLOCK 64
+
+//! Requests served on a connection before it is closed
+#define HTTP_KEEP_ALIVE_REQUESTS 100
+
+//! Time a connection is kept open without receiving anything (ms)
+#define HTTP_KEEP_ALIVE_MS 5000
+
+//! Longest time to receive a request from its first byte, so a client sending
+//! a byte now and then does not hold a connection forever (ms)
+#define HTTP_REQUEST_MS 5000
+
+//! Longest wait of a deferred request before it is answered anyway (ms)
+#define HTTP_LONG_POLL_MS 25000
+
+//! Time without events after which a Server-Sent Events stream gets a comment, to find the dead clients (ms)
+#define HTTP_EVENTS_HEARTBEAT_MS 15000
+
+//! Longest Server-Sent Event written by httpEvent(), framing included
+#define HTTP_EVENT_SIZE 128
+
+#define HTTP_PARSE_MORE     0   //!< The request is not complete, more bytes are needed
+#define HTTP_PARSE_DONE     1   //!< The request is complete
+#define HTTP_PARSE_ERROR    2   //!< The request is malformed, answer with error()
+
+#define HTTP_METHOD_GET     0   //!< GET request
+#define HTTP_METHOD_OTHER   1   //!< Any other method, not served
+
+class HttpParser;
+
+/**
+ * Handler of a route, it answers with HttpParser::respond()
+ *
+ * @param out Where the answer is written, the client connection
+ * @param request The request, HttpParser::query() is the query string after the '?'
+ */
+typedef void (*HttpHandler)(Print& out, HttpParser& request);
+
+/**
+ * Write the answer to a request
+ *
+ * @param out The client connection
+ * @param status The HTTP status, e.g. 200
+ * @param body The text of the answer
+ * @param keepAlive Whether the connection stays open after the answer
+ */
+void httpRespond(Print& out, int status, const char* body, bool keepAlive);
+
+/**
+ * Write a Server-Sent Event on a stream started by HttpParser::respondEvents()
+ *
+ * @param out The client connection
+ * @param data The text of the event, a single line shorter than HTTP_EVENT_SIZE - 8
+ */
+void httpEvent(Print& out, const char* data);
+
+//! A path served by a handler
+struct HttpRoute {
+  const char* path;         //!< The path, e.g. HTTPGET_MOVE
+  HttpHandler handler;      //!< The handler of the GET requests of the path
+};
+
+/**
+ * The HttpParser class reads a request byte by byte. Every connection has its
+ * own parser, started with begin() when the connection is accepted and reset
+ * before every following request.
+ */
+class HttpParser {
+  //! Position in the request, one of the states of http_parser.cpp
+  uint8_t state;
+
+  //! Request target, path and query, zero-terminated
+  char target[HTTP_TARGET_SIZE];
+
+  //! Characters of the target kept, the query start, the length of the current header line
+  uint8_t length;
+  uint8_t queryStart;
+  uint8_t lineLength;
+
+  //! Characters of the method matched against "GET"
+  uint8_t methodLength;
+
+  //! Characters of the current header line matched against "connection:", HTTP_HEADER_SKIP if not that header
+  uint8_t header;
+
+  //! The client wants the connection open after the answer
+  bool persistent;
+
+  //! Requests received on the connection
+  uint8_t requests;
+
+  //! The handler has not answered yet
+  bool deferred;
+
+  //! One of the HTTP_METHOD_*
+  uint8_t method;
+
+  //! HTTP status of the error found, 0 if none
+  uint16_t errorStatus;
+
+public:
+  HttpParser() { begin(); }
+
+  //! Get ready for the first request of a new connection
+  void begin();
+
+  //! Get ready for the next request of the connection
+  void reset();
+
+  /**
+   * Parse the next byte of the request
+   *
+   * @param c The byte
+   *
+   * @return One of HTTP_PARSE_*
+   */
+  int feed(char c);
+
+  /**
+   * Parse the next bytes of the request, as read in a block from the client.
+   * The parsing stops at the end of the request.
+   *
+   * @param data The bytes
+   * @param size Number of bytes
+   * @param used Number of bytes parsed, the following ones belong to the next request
+   *
+   * @return One of HTTP_PARSE_*
+   */
+  int feed(const char* data, int size, int& used);
+
+  //! Method of the request, one of HTTP_METHOD_*
+  int getMethod() const { return method; }
+
+  //! Path of the request, without the query
+  const char* path() const { return target; }
+
+  //! Query of the request after the '?', empty if none
+  const char* query() const { return target + queryStart; }
+
+  //! HTTP status of a malformed request: 400, 405 or 414
+  int error() const { return errorStatus; }
+
+  /**
+   * Whether the connection stays open after the answer: the client asked for
+   * it, the request is a well formed GET and the connection has not served
+   * HTTP_KEEP_ALIVE_REQUESTS requests
+   */
+  bool keepAlive() const;
+
+  /**
+   * Answer the request
+   *
+   * @param out The client connection
+   * @param status The HTTP status, e.g. 200
+   * @param body The text of the answer
+   */
+  void respond(Print& out, int status, const char* body) const { httpRespond(out, status, body, keepAlive()); }
+
+  /**
+   * Answer the request later: the request is kept until the server answers
+   * with respond() and reset() for the next request. Meanwhile the
+   * connection is not read.
+   */
+  void defer() { deferred = true; }
+
+  //! The request is waiting for its answer
+  bool isDeferred() const { return deferred; }
+
+  /**
+   * Answer with a Server-Sent Events stream, the events are then written
+   * with httpEvent(). The request stays deferred while the stream is open.
+   *
+   * @param out The client connection
+   */
+  void respondEvents(Print& out);
+
+  /**
+   * Call the handler of the request path, or answer with an error status
+   * if the request is malformed, it is not a GET or the path is unknown
+   *
+   * @param out Where the answer is written
+   * @param routes The served paths
+   * @param count Number of routes
+   *
+   * @return true if a handler has been called
+   */
+  bool dispatch(Print& out, const HttpRoute* routes, int count);
+};
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * @file kpk.cpp
+ * @brief Probe of the King and pawn against King bitbase
+ */
+
+#include "kpk.h"
+
+int kpkProbe(const Board& board) {
+  Bitboard pawns = board.getPieces(PAWN, PLAY_WHITE) | board.getPieces(PAWN, PLAY_BLACK);
+
+  // Most positions have more than one pawn, the test of the ending is cheap
+  if (pawns == 0 || (pawns & (pawns - 1)) != 0 || popCount(board.getOccupied()) != 3) {
+    return KPK_NONE;
+  }
+
+  // Bring the pawn to white by flipping the ranks and to the files a to d by mirroring them
+  ChessColor strong = board.getPieces(PAWN, PLAY_WHITE) ? PLAY_WHITE : PLAY_BLACK;
+  ChessColor weak = (strong == PLAY_WHITE) ? PLAY_BLACK : PLAY_WHITE;
+  uint8_t flip = (strong == PLAY_WHITE) ? 0 : 56;
+  uint8_t pawn = firstSquare(pawns) ^ flip;
+  if (squareX(pawn) > 3) {
+    flip ^= 7;
+    pawn ^= 7;
+  }
+  uint8_t strongKing = firstSquare(board.getPieces(KING, strong)) ^ flip;
+  uint8_t weakKing = firstSquare(board.getPieces(KING, weak)) ^ flip;
+  ChessColor turn = (board.getTurn() == strong) ? PLAY_WHITE : PLAY_BLACK;
+
+  uint32_t index = kpkIndex(turn, strongKing, pawn, weakKing);
+  return (pgm_read_dword(&KPK_BITBASE[index / 32]) >> (index % 32)) & 1 ? KPK_WIN : KPK_DRAW;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file kpk.h
+ * @brief Bitbase of the King and pawn against King endings
+ *
+ * One bit for every position with white having the pawn tells if white wins.
+ * The pawn is kept on the files a to d by mirroring the board, so the index is
+ * made of the player in turn, the 24 pawn squares and the squares of the two
+ * Kings: 196608 bits, 24 KB of flash. The bitbase is calculated on the host by
+ * the kpk_gen tool, with a retrograde analysis of all the positions, and a
+ * probe is a single bit read.
+ */
+
+#ifndef _KPK
+#define _KPK
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "chess_moves.h"
+
+//! Squares of the pawn in the bitbase: files a to d, ranks 2 to 7
+#define KPK_PAWN_SQUARES 24
+
+//! Positions of the bitbase
+#define KPK_POSITIONS (2UL * KPK_PAWN_SQUARES * BOARD_SQUARES * BOARD_SQUARES)
+
+//! 32-bit words of the bitbase
+#define KPK_WORDS (KPK_POSITIONS / 32)
+
+#define KPK_NONE   -1   //!< The position is not a King and pawn against King ending
+#define KPK_DRAW    0   //!< The position is a draw
+#define KPK_WIN     1   //!< The side with the pawn wins
+
+/**
+ * Index of a position with white having the pawn on the files a to d
+ *
+ * @param turn The player in turn
+ * @param whiteKing, pawn, blackKing The squares of the pieces
+ */
+inline uint32_t kpkIndex(ChessColor turn, uint8_t whiteKing, uint8_t pawn, uint8_t blackKing) {
+  uint32_t pawnIndex = (squareY(pawn) - 1) * 4 + squareX(pawn);
+  return (((uint32_t)turn * KPK_PAWN_SQUARES + pawnIndex) * BOARD_SQUARES + whiteKing) * BOARD_SQUARES + blackKing;
+}
+
+//! The bitbase, bit i of word i / 32 is set if the position of index i is won
+extern const uint32_t KPK_BITBASE[KPK_WORDS] PROGMEM;
+
+/**
+ * Verdict of a King and pawn against King position
+ *
+ * @param board The position
+ *
+ * @return KPK_WIN or KPK_DRAW, KPK_NONE if the board has other pieces
+ */
+int kpkProbe(const Board& board);
+
+#endif
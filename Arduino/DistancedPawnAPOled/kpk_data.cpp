@@ -0,0 +1,777 @@
+/**
+ * @file kpk_data.cpp
+ * @brief King and pawn against King bitbase, generated by kpk_gen
+ */
+
+#include "kpk.h"
+
+const uint32_t KPK_BITBASE[KPK_WORDS] PROGMEM = {
+  0xC0C0FCFC, 0xC0C0C0C0, 0xC0C0F8F8, 0xC0C0C0C0, 0xC0C0F0F1, 0xC0C0C0C0, 0xC0C0E2E3, 0xC0C0C0C0,
+  0xC0C0C6C7, 0xC0C0C0C0, 0xC0C08E8F, 0xC0C0C0C0, 0xC0C01E1F, 0xC0C0C0C0, 0xC0C03E3F, 0xC0C0C0C0,
+  0x00000000, 0x00000000, 0xC0F8F8F8, 0xC0C0C0C0, 0xC0F0F0F1, 0xC0C0C0C0, 0xC0E0E2E3, 0xC0C0C0C0,
+  0xC0C0C6C7, 0xC0C0C0C0, 0xC0808E8F, 0xC0C0C0C0, 0xC0001E1F, 0xC0C0C0C0, 0xC0003E3F, 0xC0C0C0C0,
+  0xF8F8FCFF, 0xC0C0C0C0, 0xF8F8F8FF, 0xC0C0C0C0, 0xF0F0F0FF, 0xC0C0C0C0, 0xE0E0E2FF, 0xC0C0C0C0,
+  0xC0C0C6FF, 0xC0C0C0C0, 0x80808EFF, 0xC0C0C0C0, 0x00001EFF, 0xC0C0C0C0, 0x00003EFF, 0xC0C0C0C0,
+  0xF8FCFEFF, 0xE0E0E0F8, 0xF8F8FEFF, 0xE0E0E0F8, 0xF0F0FEFF, 0xE0E0E0F0, 0xE0E0FEFF, 0xE0E0E0E0,
+  0xC0C0FEFF, 0xE0E0E0C0, 0x8080FEFF, 0xC0C0C080, 0x0000FEFF, 0xC0C0C000, 0x0000FEFF, 0xC0C0C000,
+  0xF8FCFEFF, 0xF0F0F8F8, 0xF8FCFEFF, 0xF0F0F8F8, 0xF0FCFEFF, 0xF0F0F0F0, 0xE0FCFEFF, 0xF0F0E0E0,
+  0xC0F8FEFF, 0xE0E0C0C0, 0x80F0FEFF, 0xC0C08080, 0x00E0FEFF, 0xC0C00000, 0x00C0FEFF, 0xC0C00000,
+  0xF8FCFEFF, 0xF8F8F8F8, 0xFCFCFEFF, 0xF8F8F8F8, 0xF8FCFEFF, 0xF8F0F0F0, 0xF0FCFEFF, 0xF0E0E0E0,
+  0xE0F8FEFF, 0xE0C0C0C0, 0xC0F0FEFF, 0xC0808080, 0xC0E0FEFF, 0xC0000000, 0xC0C0FEFF, 0xC0000000,
+  0xF8F8FEFF, 0xF8F8F8F8, 0xF8F8FEFF, 0xF8F8F8F8, 0xF8F8FEFF, 0xF0F0F0F8, 0xF0F0FEFF, 0xE0E0E0F0,
+  0xE0E0FEFF, 0xC0C0C0E0, 0xC0C0FEFF, 0x808080C0, 0xC0C0FEFF, 0x000000C0, 0xC0C0FEFF, 0x000000C0,
+  0xF0F0FEFF, 0xF8F8F0F0, 0xF0F0FEFF, 0xF8F8F0F0, 0xF0F0FEFF, 0xF0F0F0F0, 0xF0F0FEFF, 0xE0E0F0F0,
+  0xE0E0FEFF, 0xC0C0E0E0, 0xC0C0FEFF, 0x8080C0C0, 0xC0C0FEFF, 0x0000C0C0, 0xC0C0FEFF, 0x0000C0C0,
+  0xF8F8FCFC, 0xFFF8F8F8, 0xF8F8F8F8, 0xFFF8F8F8, 0xF0F0F1F1, 0xFFF0F0F0, 0xF0F0E1E3, 0xFFF0F0F0,
+  0xE0E0C5C7, 0xFFE0E0E0, 0xC0C08D8F, 0xFFC0C0C0, 0x80801D1F, 0xE0808080, 0x80803D3F, 0xC0808080,
+  0xFCF8FCFC, 0xFFFFFCFF, 0x00000000, 0x00000000, 0xF9F0F1F1, 0xFFFFF9FF, 0xF1E0E1E3, 0xFFFFF1FD,
+  0xE0C0C5C7, 0xFFFFE0F8, 0xC0808D8F, 0xFFF0C0F0, 0x80001D1F, 0xE0E080E0, 0x80003D3F, 0xC0C080C0,
+  0xFCF8FCFF, 0xFFFFFFFE, 0xF8F8F8FF, 0xFFFFFFFD, 0xF1F0F1FF, 0xFFFFFFFB, 0xE1E0E1FF, 0xFFFFFFF5,
+  0xC0C0C5FF, 0xFFFFF8E8, 0x80808DFF, 0xFFF0F0D0, 0x00001DFF, 0xE0E0E0A0, 0x00003DFF, 0xC0C0C0C0,
+  0xFCF8FDFF, 0xFFFFFFFC, 0xF8F8FDFF, 0xFFFFFFF8, 0xF1F0FDFF, 0xFFFFFFF1, 0xE1E0FDFF, 0xFFFFFFE1,
+  0xC0C0FDFF, 0xFFFFF8C0, 0x8080FDFF, 0xFFF0F080, 0x0000FDFF, 0xE0E0E000, 0x0000FDFF, 0xC0C0C000,
+  0xFCF8FDFF, 0xFFFFFCFC, 0xF8F8FDFF, 0xFFFFF8F8, 0xF1F8FDFF, 0xFFFFF1F1, 0xE1F8FDFF, 0xFFFFE3E1,
+  0xC0F8FDFF, 0xFFFFC0C0, 0x80F0FDFF, 0xFFF08080, 0x00E0FDFF, 0xE0E00000, 0x00C0FDFF, 0xC0C00000,
+  0xF8F8FDFF, 0xFFFCFCFC, 0xF8F8FDFF, 0xFFF8F8F8, 0xF8F8FDFF, 0xFFF1F1F1, 0xF0F8FDFF, 0xFFE3E1E1,
+  0xE0F8FDFF, 0xFFC7C0C0, 0xC0F0FDFF, 0xFF808080, 0x80E0FDFF, 0xE0000000, 0x80C0FDFF, 0xC0000000,
+  0xF0F0FDFF, 0xFCFCFCF0, 0xF0F0FDFF, 0xF8F8F8F0, 0xF0F0FDFF, 0xF1F1F1F0, 0xF0F0FDFF, 0xE3E1E1F0,
+  0xE0E0FDFF, 0xC7C0C0E0, 0xC0C0FDFF, 0x8F8080C0, 0x8080FDFF, 0x00000080, 0x8080FDFF, 0x00000080,
+  0xE0E0FDFF, 0xFCFCE0E0, 0xE0E0FDFF, 0xF8F8E0E0, 0xE0E0FDFF, 0xF1F1E0E0, 0xE0E0FDFF, 0xE1E1E0E0,
+  0xE0E0FDFF, 0xC0C0E0E0, 0xC0C0FDFF, 0x8080C0C0, 0x8080FDFF, 0x00008080, 0x8080FDFF, 0x00008080,
+  0xF0F0F8FC, 0xFFF0F0F0, 0xF0F0F8F8, 0xFFF0F0F0, 0xF1F1F1F1, 0xFFF1F1F1, 0xE1E1E3E3, 0xFFE1E1E1,
+  0xE1E1C3C7, 0xFFE1E1E1, 0xC1C18B8F, 0xFFC1C1C1, 0x80801B1F, 0xFF808080, 0x00003B3F, 0xC0000000,
+  0xF8F0F8FC, 0xFFFFF8FB, 0xF9F0F8F8, 0xFFFFF9FF, 0x00000000, 0x00000000, 0xF3E1E3E3, 0xFFFFF3FF,
+  0xE3C1C3C7, 0xFFFFE3FB, 0xC1818B8F, 0xFFFFC1F1, 0x80001B1F, 0xFFE080E0, 0x00003B3F, 0xC0C000C0,
+  0xF8F0F8FF, 0xFFFFFFFA, 0xF8F0F8FF, 0xFFFFFFFD, 0xF1F1F1FF, 0xFFFFFFFB, 0xE3E1E3FF, 0xFFFFFFF7,
+  0xC3C1C3FF, 0xFFFFFFEB, 0x81818BFF, 0xFFFFF1D1, 0x00001BFF, 0xFFE0E0A0, 0x00003BFF, 0xC0C0C040,
+  0xF8F0FBFF, 0xFFFFFFF8, 0xF8F0FBFF, 0xFFFFFFF8, 0xF1F1FBFF, 0xFFFFFFF1, 0xE3E1FBFF, 0xFFFFFFE3,
+  0xC3C1FBFF, 0xFFFFFFC3, 0x8181FBFF, 0xFFFFF181, 0x0000FBFF, 0xFFE0E000, 0x0000FBFF, 0xC0C0C000,
+  0xF8F1FBFF, 0xFFFFFCF8, 0xF8F1FBFF, 0xFFFFF8F8, 0xF1F1FBFF, 0xFFFFF1F1, 0xE3F1FBFF, 0xFFFFE3E3,
+  0xC3F1FBFF, 0xFFFFC7C3, 0x81F1FBFF, 0xFFFF8181, 0x00E0FBFF, 0xFFE00000, 0x00C0FBFF, 0xC0C00000,
+  0xF0F1FBFF, 0xFFFCF8F8, 0xF1F1FBFF, 0xFFF8F8F8, 0xF1F1FBFF, 0xFFF1F1F1, 0xF1F1FBFF, 0xFFE3E3E3,
+  0xE1F1FBFF, 0xFFC7C3C3, 0xC1F1FBFF, 0xFF8F8181, 0x80E0FBFF, 0xFF000000, 0x00C0FBFF, 0xC0000000,
+  0xE0E0FBFF, 0xFCF8F8E0, 0xE0E0FBFF, 0xF8F8F8E0, 0xE0E0FBFF, 0xF1F1F1E0, 0xE0E0FBFF, 0xE3E3E3E0,
+  0xE0E0FBFF, 0xC7C3C3E0, 0xC0C0FBFF, 0x8F8181C0, 0x8080FBFF, 0x1F000080, 0x0000FBFF, 0x00000000,
+  0xC0C0FBFF, 0xF8F8C0C0, 0xC0C0FBFF, 0xF8F8C0C0, 0xC0C0FBFF, 0xF1F1C0C0, 0xC0C0FBFF, 0xE3E3C0C0,
+  0xC0C0FBFF, 0xC3C3C0C0, 0xC0C0FBFF, 0x8181C0C0, 0x8080FBFF, 0x00008080, 0x0000FBFF, 0x00000000,
+  0xE0E0F4FC, 0xFFE0E0E0, 0xE1E1F0F8, 0xFFE1E1E1, 0xE1E1F1F1, 0xFFE1E1E1, 0xE3E3E3E3, 0xFFE3E3E3,
+  0xC3C3C7C7, 0xFFC3C3C3, 0xC3C3878F, 0xFFC3C3C3, 0x8383171F, 0xFF838383, 0x0101373F, 0xFF010101,
+  0xE0E0F4FC, 0xFFFFE0E3, 0xF1E0F0F8, 0xFFFFF1F7, 0xF3E1F1F1, 0xFFFFF3FF, 0x00000000, 0x00000000,
+  0xE7C3C7C7, 0xFFFFE7FF, 0xC783878F, 0xFFFFC7F7, 0x8303171F, 0xFFFF83E3, 0x0101373F, 0xFFC101C1,
+  0xE0E0F4FF, 0xFFFFE3E2, 0xF0E0F0FF, 0xFFFFFFF5, 0xF1E1F1FF, 0xFFFFFFFB, 0xE3E3E3FF, 0xFFFFFFF7,
+  0xC7C3C7FF, 0xFFFFFFEF, 0x878387FF, 0xFFFFFFD7, 0x030317FF, 0xFFFFE3A3, 0x010137FF, 0xFFC1C141,
+  0xE0E0F7FF, 0xFFFFE3E0, 0xF0E0F7FF, 0xFFFFFFF0, 0xF1E1F7FF, 0xFFFFFFF1, 0xE3E3F7FF, 0xFFFFFFE3,
+  0xC7C3F7FF, 0xFFFFFFC7, 0x8783F7FF, 0xFFFFFF87, 0x0303F7FF, 0xFFFFE303, 0x0101F7FF, 0xFFC1C101,
+  0xE0E3F7FF, 0xFFFFE0E0, 0xF0E3F7FF, 0xFFFFF8F0, 0xF1E3F7FF, 0xFFFFF1F1, 0xE3E3F7FF, 0xFFFFE3E3,
+  0xC7E3F7FF, 0xFFFFC7C7, 0x87E3F7FF, 0xFFFF8F87, 0x03E3F7FF, 0xFFFF0303, 0x01C1F7FF, 0xFFC10101,
+  0xE0E3F7FF, 0xFFFCE0E0, 0xE1E3F7FF, 0xFFF8F0F0, 0xE3E3F7FF, 0xFFF1F1F1, 0xE3E3F7FF, 0xFFE3E3E3,
+  0xE3E3F7FF, 0xFFC7C7C7, 0xC3E3F7FF, 0xFF8F8787, 0x83E3F7FF, 0xFF1F0303, 0x01C1F7FF, 0xFF010101,
+  0xC0C0F7FF, 0xFCE0E0C0, 0xC1C1F7FF, 0xF8F0F0C1, 0xC1C1F7FF, 0xF1F1F1C1, 0xC1C1F7FF, 0xE3E3E3C1,
+  0xC1C1F7FF, 0xC7C7C7C1, 0xC1C1F7FF, 0x8F8787C1, 0x8181F7FF, 0x1F030381, 0x0101F7FF, 0x3F010101,
+  0x8080F7FF, 0xE0E08080, 0x8080F7FF, 0xF0F08080, 0x8080F7FF, 0xF1F18080, 0x8080F7FF, 0xE3E38080,
+  0x8080F7FF, 0xC7C78080, 0x8080F7FF, 0x87878080, 0x8080F7FF, 0x03038080, 0x0000F7FF, 0x01010000,
+  0xC0C0FCFC, 0xC0C0C0C0, 0xC0C0F8F8, 0xC0C0C0C0, 0xC0C0F1F1, 0xC0C0C0C0, 0xC0C0E3E3, 0xC0C0C0C0,
+  0xC0C0C7C7, 0xC0C0C0C0, 0xC0C08F8F, 0xC0C0C0C0, 0xC0C01F1F, 0xC0C0C0C0, 0xC0C03F3F, 0xC0C0C0C0,
+  0xC0F8FCFC, 0xC0C0C0C0, 0xC0F8F8F8, 0xC0C0C0C0, 0xC0F0F1F1, 0xC0C0C0C0, 0xC0E0E3E3, 0xC0C0C0C0,
+  0xC0C0C7C7, 0xC0C0C0C0, 0xC0808F8F, 0xC0C0C0C0, 0xC0001F1F, 0xC0C0C0C0, 0xC0003F3F, 0xC0C0C0C0,
+  0x00000000, 0x00000000, 0xF8F8F8FF, 0xC0C0C0C0, 0xF0F0F1FF, 0xC0C0C0C0, 0xE0E0E3FF, 0xC0C0C0C0,
+  0xC0C0C7FF, 0xC0C0C0C0, 0x80808FFF, 0xC0C0C0C0, 0x00001FFF, 0xC0C0C0C0, 0x00003FFF, 0xC0C0C0C0,
+  0xF8FCFFFF, 0xE0E0E0F8, 0xF8F8FFFF, 0xE0E0E0F8, 0xF0F0FFFF, 0xE0E0E0F0, 0xE0E0FFFF, 0xE0E0E0E0,
+  0xC0C0FFFF, 0xE0E0E0C0, 0x8080FFFF, 0xC0C0C080, 0x0000FFFF, 0xC0C0C000, 0x0000FFFF, 0xC0C0C000,
+  0xF8FEFFFF, 0xF0F0F8F8, 0xF8FEFFFF, 0xF0F0F8F8, 0xF0FCFFFF, 0xF0F0F0F0, 0xE0F8FFFF, 0xF0F0E0E0,
+  0xC0F0FFFF, 0xE0E0C0C0, 0x80E0FFFF, 0xC0C08080, 0x00C0FFFF, 0xC0C00000, 0x00C0FFFF, 0xC0C00000,
+  0xF8FCFFFF, 0xF8F8F8F8, 0xFCFCFFFF, 0xF8F8F8F8, 0xF8FCFFFF, 0xF8F0F0F0, 0xF0F8FFFF, 0xF0E0E0E0,
+  0xE0F0FFFF, 0xE0C0C0C0, 0xC0E0FFFF, 0xC0808080, 0xC0C0FFFF, 0xC0000000, 0xC0C0FFFF, 0xC0000000,
+  0xF8F8FFFF, 0xF8F8F8F8, 0xF8F8FFFF, 0xF8F8F8F8, 0xF8F8FFFF, 0xF0F0F0F8, 0xF0F0FFFF, 0xE0E0E0F0,
+  0xE0E0FFFF, 0xC0C0C0E0, 0xC0C0FFFF, 0x808080C0, 0xC0C0FFFF, 0x000000C0, 0xC0C0FFFF, 0x000000C0,
+  0xF0F0FFFF, 0xF8F8F0F0, 0xF0F0FFFF, 0xF8F8F0F0, 0xF0F0FFFF, 0xF0F0F0F0, 0xF0F0FFFF, 0xE0E0F0F0,
+  0xE0E0FFFF, 0xC0C0E0E0, 0xC0C0FFFF, 0x8080C0C0, 0xC0C0FFFF, 0x0000C0C0, 0xC0C0FFFF, 0x0000C0C0,
+  0xF0F8FCFC, 0xF0F0F0F0, 0xF0F8F8F8, 0xF0F0F0F0, 0xF0F8F1F1, 0xF0F0F0F0, 0xE0E0E3E3, 0xE0E0E0E0,
+  0xE0E0C7C7, 0xE0E0E0E0, 0xC0C08F8F, 0xC0C0C0C0, 0x80801F1F, 0x80808080, 0x80803F3F, 0x80808080,
+  0xF8FCFCFC, 0xF8F8F8F8, 0xF8F8F8F8, 0xF8F8F8F8, 0xF0F1F1F1, 0xF0F0F0F0, 0xF0E1E3E3, 0xF0F0F0F0,
+  0xE0C0C7C7, 0xE0E0E0E0, 0xC0808F8F, 0xC0C0C0C0, 0x80001F1F, 0x80808080, 0x80003F3F, 0x80808080,
+  0xF8FCFCFF, 0xFFFCFFFC, 0x00000000, 0x00000000, 0xF0F1F1FF, 0xFFF9FFF9, 0xE0E1E3FF, 0xFFF1FDF1,
+  0xC0C0C7FF, 0xFFE0F8E0, 0x80808FFF, 0xF0C0F0C0, 0x00001FFF, 0xE080E080, 0x00003FFF, 0xC080C080,
+  0xF8FCFFFF, 0xFFFFFEFC, 0xF8F8FFFF, 0xFFFFFDF8, 0xF0F1FFFF, 0xFFFFFBF1, 0xE0E1FFFF, 0xFFFFF5E1,
+  0xC0C0FFFF, 0xFFF8E8C0, 0x8080FFFF, 0xF0F0D080, 0x0000FFFF, 0xE0E0A000, 0x0000FFFF, 0xC0C0C000,
+  0xF8FDFFFF, 0xFFFFFCFC, 0xF8FDFFFF, 0xFFFFF8F8, 0xF0FDFFFF, 0xFFFFF1F1, 0xE0F9FFFF, 0xFFFFE1E1,
+  0xC0F0FFFF, 0xFFF8C0C0, 0x80E0FFFF, 0xF0F08080, 0x00C0FFFF, 0xE0E00000, 0x0080FFFF, 0xC0C00000,
+  0xF8F8FFFF, 0xFFFCFCFC, 0xF8F8FFFF, 0xFFF8F8F8, 0xF8F8FFFF, 0xFFF1F1F1, 0xF0F8FFFF, 0xFFE3E1E1,
+  0xE0F0FFFF, 0xFFC0C0C0, 0xC0E0FFFF, 0xF0808080, 0x80C0FFFF, 0xE0000000, 0x8080FFFF, 0xC0000000,
+  0xF0F0FFFF, 0xFCFCFCF8, 0xF0F0FFFF, 0xF8F8F8F8, 0xF0F0FFFF, 0xF1F1F1F8, 0xF0F0FFFF, 0xE3E1E1F0,
+  0xE0E0FFFF, 0xC7C0C0E0, 0xC0C0FFFF, 0x808080C0, 0x8080FFFF, 0x00000080, 0x8080FFFF, 0x00000080,
+  0xE0E0FFFF, 0xFCFCF0E0, 0xE0E0FFFF, 0xF8F8F0E0, 0xE0E0FFFF, 0xF1F1F0E0, 0xE0E0FFFF, 0xE1E1F0E0,
+  0xE0E0FFFF, 0xC0C0E0E0, 0xC0C0FFFF, 0x8080C0C0, 0x8080FFFF, 0x00008080, 0x8080FFFF, 0x00008080,
+  0xE0F0FCFC, 0xE0E0E0E0, 0xE0F1F8F8, 0xE0E0E0E0, 0xE0F1F1F1, 0xE0E0E0E0, 0xE0F1E3E3, 0xE0E0E0E0,
+  0xC0C1C7C7, 0xC0C0C0C0, 0xC0C18F8F, 0xC0C0C0C0, 0x80801F1F, 0x80808080, 0x00003F3F, 0x00000000,
+  0xF0F8FCFC, 0xF0F0F0F0, 0xF0F8F8F8, 0xF0F0F0F0, 0xF1F1F1F1, 0xF1F1F1F1, 0xE1E3E3E3, 0xE1E1E1E1,
+  0xE1C3C7C7, 0xE1E1E1E1, 0xC1818F8F, 0xC1C1C1C1, 0x80001F1F, 0x80808080, 0x00003F3F, 0x00000000,
+  0xF0F8FCFF, 0xFFF8FBF8, 0xF0F8F8FF, 0xFFF9FFF9, 0x00000000, 0x00000000, 0xE1E3E3FF, 0xFFF3FFF3,
+  0xC1C3C7FF, 0xFFE3FBE3, 0x81818FFF, 0xFFC1F1C1, 0x00001FFF, 0xE080E080, 0x00003FFF, 0xC000C000,
+  0xF0F8FFFF, 0xFFFFFAF8, 0xF0F8FFFF, 0xFFFFFDF8, 0xF1F1FFFF, 0xFFFFFBF1, 0xE1E3FFFF, 0xFFFFF7E3,
+  0xC1C3FFFF, 0xFFFFEBC3, 0x8181FFFF, 0xFFF1D181, 0x0000FFFF, 0xE0E0A000, 0x0000FFFF, 0xC0C04000,
+  0xF0F9FFFF, 0xFFFFF8F8, 0xF0FBFFFF, 0xFFFFF8F8, 0xF1FBFFFF, 0xFFFFF1F1, 0xE1FBFFFF, 0xFFFFE3E3,
+  0xC1F3FFFF, 0xFFFFC3C3, 0x81E1FFFF, 0xFFF18181, 0x00C0FFFF, 0xE0E00000, 0x0080FFFF, 0xC0C00000,
+  0xF0F1FFFF, 0xFFFCF8F8, 0xF1F1FFFF, 0xFFF8F8F8, 0xF1F1FFFF, 0xFFF1F1F1, 0xF1F1FFFF, 0xFFE3E3E3,
+  0xE1F1FFFF, 0xFFC7C3C3, 0xC1E1FFFF, 0xFF818181, 0x80C0FFFF, 0xE0000000, 0x0080FFFF, 0xC0000000,
+  0xE0E0FFFF, 0xFCF8F8F0, 0xE0E0FFFF, 0xF8F8F8F1, 0xE0E0FFFF, 0xF1F1F1F1, 0xE0E0FFFF, 0xE3E3E3F1,
+  0xE0E0FFFF, 0xC7C3C3E1, 0xC0C0FFFF, 0x8F8181C1, 0x8080FFFF, 0x00000080, 0x0000FFFF, 0x00000000,
+  0xC0C0FFFF, 0xF8F8E0C0, 0xC0C0FFFF, 0xF8F8E0C0, 0xC0C0FFFF, 0xF1F1E0C0, 0xC0C0FFFF, 0xE3E3E0C0,
+  0xC0C0FFFF, 0xC3C3E0C0, 0xC0C0FFFF, 0x8181C0C0, 0x8080FFFF, 0x00008080, 0x0000FFFF, 0x00000000,
+  0xC0E0FCFC, 0xC0C0C0C0, 0xC0E0F8F8, 0xC0C0C0C0, 0xC1E3F1F1, 0xC1C1C1C1, 0xC1E3E3E3, 0xC1C1C1C1,
+  0xC1E3C7C7, 0xC1C1C1C1, 0x81838F8F, 0x81818181, 0x81831F1F, 0x81818181, 0x01013F3F, 0x01010101,
+  0xE0E0FCFC, 0xE0E0E0E0, 0xE1F0F8F8, 0xE1E1E1E1, 0xE1F1F1F1, 0xE1E1E1E1, 0xE3E3E3E3, 0xE3E3E3E3,
+  0xC3C7C7C7, 0xC3C3C3C3, 0xC3878F8F, 0xC3C3C3C3, 0x83031F1F, 0x83838383, 0x01013F3F, 0x01010101,
+  0xE0E0FCFF, 0xFFE0E3E0, 0xE0F0F8FF, 0xFFF1F7F1, 0xE1F1F1FF, 0xFFF3FFF3, 0x00000000, 0x00000000,
+  0xC3C7C7FF, 0xFFE7FFE7, 0x83878FFF, 0xFFC7F7C7, 0x03031FFF, 0xFF83E383, 0x01013FFF, 0xC101C101,
+  0xE0E0FFFF, 0xFFE3E2E0, 0xE0F0FFFF, 0xFFFFF5F0, 0xE1F1FFFF, 0xFFFFFBF1, 0xE3E3FFFF, 0xFFFFF7E3,
+  0xC3C7FFFF, 0xFFFFEFC7, 0x8387FFFF, 0xFFFFD787, 0x0303FFFF, 0xFFE3A303, 0x0101FFFF, 0xC1C14101,
+  0xE0E1FFFF, 0xFFE3E0E0, 0xE0F3FFFF, 0xFFFFF0F0, 0xE1F7FFFF, 0xFFFFF1F1, 0xE3F7FFFF, 0xFFFFE3E3,
+  0xC3F7FFFF, 0xFFFFC7C7, 0x83E7FFFF, 0xFFFF8787, 0x03C3FFFF, 0xFFE30303, 0x0181FFFF, 0xC1C10101,
+  0xE0E1FFFF, 0xFFE0E0E0, 0xE1E3FFFF, 0xFFF8F0F0, 0xE3E3FFFF, 0xFFF1F1F1, 0xE3E3FFFF, 0xFFE3E3E3,
+  0xE3E3FFFF, 0xFFC7C7C7, 0xC3E3FFFF, 0xFF8F8787, 0x83C3FFFF, 0xFF030303, 0x0181FFFF, 0xC1010101,
+  0xC0C0FFFF, 0xFCE0E0E0, 0xC1C1FFFF, 0xF8F0F0E1, 0xC1C1FFFF, 0xF1F1F1E3, 0xC1C1FFFF, 0xE3E3E3E3,
+  0xC1C1FFFF, 0xC7C7C7E3, 0xC1C1FFFF, 0x8F8787C3, 0x8181FFFF, 0x1F030383, 0x0101FFFF, 0x01010101,
+  0x8080FFFF, 0xE0E0C080, 0x8080FFFF, 0xF0F0C180, 0x8080FFFF, 0xF1F1C180, 0x8080FFFF, 0xE3E3C180,
+  0x8080FFFF, 0xC7C7C180, 0x8080FFFF, 0x8787C180, 0x8080FFFF, 0x03038180, 0x0000FFFF, 0x01010100,
+  0xE0FFFCFC, 0xE0E0E0E0, 0xE0FFF8F8, 0xE0E0E0E0, 0xE0FFF1F1, 0xE0E0E0E0, 0xE0FFE3E3, 0xE0E0E0E0,
+  0xE0FFC7C7, 0xE0E0E0E0, 0xE0FF8F8F, 0xE0E0E0E0, 0xE0FF1F1F, 0xE0E0E0E0, 0xE0FF3F3F, 0xE0E0E0E0,
+  0xE0FCFCFC, 0xE0E0E0E0, 0xE0F8F8F8, 0xE0E0E0E0, 0xE0F1F1F1, 0xE0E0E0E0, 0xE0E3E3E3, 0xE0E0E0E0,
+  0xE0C7C7C7, 0xE0E0E0E0, 0xE08F8F8F, 0xE0E0E0E0, 0xE01F1F1F, 0xE0E0E0E0, 0xE03F3F3F, 0xE0E0E0E0,
+  0xF8FCFCFF, 0xE0E0E0E0, 0xF8F8F8FF, 0xE0E0E0E0, 0xF0F1F1FF, 0xE0E0E0E0, 0xE0E3E3FF, 0xE0E0E0E0,
+  0xC0C7C7FF, 0xE0E0E0E0, 0x808F8FFF, 0xE0E0E0E0, 0x001F1FFF, 0xE0E0E0E0, 0x203F3FFF, 0xE0E0E0E0,
+  0x00000000, 0x00000000, 0xF8F8FFFF, 0xE0E0E0F8, 0xF0F1FFFF, 0xE0E0E0F0, 0xE0E3FFFF, 0xE0E0E0E0,
+  0xC0C7FFFF, 0xE0E0E0C0, 0x808FFFFF, 0xE0E0E080, 0x001FFFFF, 0xE0E0E000, 0x203FFFFF, 0xE0E0E020,
+  0xFCFFFFFF, 0xF0F0F8F8, 0xF8FFFFFF, 0xF0F0F8F8, 0xF0FFFFFF, 0xF0F0F0F0, 0xE0FFFFFF, 0xF0F0E0E0,
+  0xC0FFFFFF, 0xE0E0C0C0, 0x80FFFFFF, 0xE0E08080, 0x00FFFFFF, 0xE0E00000, 0x20FFFFFF, 0xE0E02020,
+  0xFEFFFFFF, 0xF8F8F8F8, 0xFEFFFFFF, 0xF8F8F8F8, 0xFCFFFFFF, 0xF8F0F0F0, 0xF8FFFFFF, 0xF0E0E0E0,
+  0xF0FFFFFF, 0xE0C0C0C0, 0xE0FFFFFF, 0xE0808080, 0xE0FFFFFF, 0xE0000000, 0xE0FFFFFF, 0xE0202020,
+  0xFCFFFFFF, 0xF8F8F8F8, 0xFCFFFFFF, 0xF8F8F8FC, 0xFCFFFFFF, 0xF0F0F0F8, 0xF8FFFFFF, 0xE0E0E0F0,
+  0xF0FFFFFF, 0xC0C0C0E0, 0xE0FFFFFF, 0x808080E0, 0xE0FFFFFF, 0x000000E0, 0xE0FFFFFF, 0x202020E0,
+  0xF8FFFFFF, 0xF8F8F8F8, 0xF8FFFFFF, 0xF8F8F8F8, 0xF8FFFFFF, 0xF0F0F8F8, 0xF0FFFFFF, 0xE0E0F0F0,
+  0xE0FFFFFF, 0xC0C0E0E0, 0xE0FFFFFF, 0x8080E0E0, 0xE0FFFFFF, 0x0000E0E0, 0xE0FFFFFF, 0x2020E0E0,
+  0xE0FFFCFC, 0xE0E0E0E0, 0xE0FFF8F8, 0xE0E0E0E0, 0xE0FFF1F1, 0xE0E0E0E0, 0xE0FFE3E3, 0xE0E0E0E0,
+  0xC0FFC7C7, 0xC0C0C0C0, 0xC0FF8F8F, 0xC0C0C0C0, 0xC0FF1F1F, 0xC0C0C0C0, 0xC0FF3F3F, 0xC0C0C0C0,
+  0xF8FCFCFC, 0xF0F0F0F0, 0xF8F8F8F8, 0xF0F0F0F0, 0xF8F1F1F1, 0xF0F0F0F0, 0xE0E3E3E3, 0xE0E0E0E0,
+  0xE0C7C7C7, 0xE0E0E0E0, 0xC08F8F8F, 0xC0C0C0C0, 0xC01F1F1F, 0xC0C0C0C0, 0xC03F3F3F, 0xC0C0C0C0,
+  0xFCFCFCFF, 0xF8F8F8F8, 0xF8F8F8FF, 0xF8F8F8F8, 0xF1F1F1FF, 0xF0F0F0F0, 0xE1E3E3FF, 0xF0F0F0F0,
+  0xC0C7C7FF, 0xE0E0E0E0, 0x808F8FFF, 0xC0C0C0C0, 0x001F1FFF, 0xC0C0C0C0, 0x003F3FFF, 0xC0C0C0C0,
+  0xFCFCFFFF, 0xFCFFFCF8, 0x00000000, 0x00000000, 0xF1F1FFFF, 0xF9FFF9F0, 0xE1E3FFFF, 0xF1FDF1E0,
+  0xC0C7FFFF, 0xE0F8E0C0, 0x808FFFFF, 0xC0F0C080, 0x001FFFFF, 0xC0E0C000, 0x003FFFFF, 0xC0C0C000,
+  0xFCFFFFFF, 0xFFFEFCF8, 0xF8FFFFFF, 0xFFFDF8F8, 0xF1FFFFFF, 0xFFFBF1F0, 0xE1FFFFFF, 0xFFF5E1E0,
+  0xC0FFFFFF, 0xF8E8C0C0, 0x80FFFFFF, 0xF0D08080, 0x00FFFFFF, 0xE0E00000, 0x00FFFFFF, 0xC0C00000,
+  0xFDFFFFFF, 0xFFFCFCF8, 0xFDFFFFFF, 0xFFF8F8F8, 0xFDFFFFFF, 0xFFF1F1F0, 0xF9FFFFFF, 0xFFE1E1E0,
+  0xF0FFFFFF, 0xF8C0C0C0, 0xE0FFFFFF, 0xF0808080, 0xC0FFFFFF, 0xE0000000, 0xC0FFFFFF, 0xC0000000,
+  0xF8FFFFFF, 0xFCFCFCF8, 0xF8FFFFFF, 0xF8F8F8F8, 0xF8FFFFFF, 0xF1F1F1F8, 0xF8FFFFFF, 0xE3E1E1F0,
+  0xF0FFFFFF, 0xC0C0C0E0, 0xE0FFFFFF, 0x808080C0, 0xC0FFFFFF, 0x000000C0, 0xC0FFFFFF, 0x000000C0,
+  0xF0FFFFFF, 0xFCFCF8F0, 0xF0FFFFFF, 0xF8F8F8F0, 0xF0FFFFFF, 0xF1F1F8F0, 0xF0FFFFFF, 0xE1E1F0F0,
+  0xE0FFFFFF, 0xC0C0E0E0, 0xC0FFFFFF, 0x8080C0C0, 0xC0FFFFFF, 0x0000C0C0, 0xC0FFFFFF, 0x0000C0C0,
+  0xC0FFFCFC, 0xC0C0C0C0, 0xC0FFF8F8, 0xC0C0C0C0, 0xC0FFF1F1, 0xC0C0C0C0, 0xC0FFE3E3, 0xC0C0C0C0,
+  0xC0FFC7C7, 0xC0C0C0C0, 0x80FF8F8F, 0x80808080, 0x80FF1F1F, 0x80808080, 0x80FF3F3F, 0x80808080,
+  0xF0FCFCFC, 0xE0E0E0E0, 0xF1F8F8F8, 0xE0E0E0E0, 0xF1F1F1F1, 0xE0E0E0E0, 0xF1E3E3E3, 0xE0E0E0E0,
+  0xC1C7C7C7, 0xC0C0C0C0, 0xC18F8F8F, 0xC0C0C0C0, 0x801F1F1F, 0x80808080, 0x803F3F3F, 0x80808080,
+  0xF8FCFCFF, 0xF0F0F0F0, 0xF8F8F8FF, 0xF0F0F0F0, 0xF1F1F1FF, 0xF1F1F1F1, 0xE3E3E3FF, 0xE1E1E1E1,
+  0xC3C7C7FF, 0xE1E1E1E1, 0x818F8FFF, 0xC1C1C1C1, 0x001F1FFF, 0x80808080, 0x003F3FFF, 0x80808080,
+  0xF8FCFFFF, 0xF8FBF8F0, 0xF8F8FFFF, 0xF9FFF9F0, 0x00000000, 0x00000000, 0xE3E3FFFF, 0xF3FFF3E1,
+  0xC3C7FFFF, 0xE3FBE3C1, 0x818FFFFF, 0xC1F1C181, 0x001FFFFF, 0x80E08000, 0x003FFFFF, 0x80C08000,
+  0xF8FFFFFF, 0xFFFAF8F0, 0xF8FFFFFF, 0xFFFDF8F0, 0xF1FFFFFF, 0xFFFBF1F1, 0xE3FFFFFF, 0xFFF7E3E1,
+  0xC3FFFFFF, 0xFFEBC3C1, 0x81FFFFFF, 0xF1D18181, 0x00FFFFFF, 0xE0A00000, 0x00FFFFFF, 0xC0C00000,
+  0xF9FFFFFF, 0xFFF8F8F0, 0xFBFFFFFF, 0xFFF8F8F0, 0xFBFFFFFF, 0xFFF1F1F1, 0xFBFFFFFF, 0xFFE3E3E1,
+  0xF3FFFFFF, 0xFFC3C3C1, 0xE1FFFFFF, 0xF1818181, 0xC0FFFFFF, 0xE0000000, 0x80FFFFFF, 0xC0000000,
+  0xF1FFFFFF, 0xFCF8F8F0, 0xF1FFFFFF, 0xF8F8F8F1, 0xF1FFFFFF, 0xF1F1F1F1, 0xF1FFFFFF, 0xE3E3E3F1,
+  0xF1FFFFFF, 0xC7C3C3E1, 0xE1FFFFFF, 0x818181C1, 0xC0FFFFFF, 0x00000080, 0x80FFFFFF, 0x00000080,
+  0xE0FFFFFF, 0xF8F8F0E0, 0xE0FFFFFF, 0xF8F8F1E0, 0xE0FFFFFF, 0xF1F1F1E0, 0xE0FFFFFF, 0xE3E3F1E0,
+  0xE0FFFFFF, 0xC3C3E1E0, 0xC0FFFFFF, 0x8181C1C0, 0x80FFFFFF, 0x00008080, 0x80FFFFFF, 0x00008080,
+  0x80FFFCFC, 0x80808080, 0x80FFF8F8, 0x80808080, 0x80FFF1F1, 0x80808080, 0x80FFE3E3, 0x80808080,
+  0x80FFC7C7, 0x80808080, 0x80FF8F8F, 0x80808080, 0x00FF1F1F, 0x00000000, 0x00FF3F3F, 0x00000000,
+  0xE0FCFCFC, 0xC0C0C0C0, 0xE0F8F8F8, 0xC0C0C0C0, 0xE3F1F1F1, 0xC1C1C1C1, 0xE3E3E3E3, 0xC1C1C1C1,
+  0xE3C7C7C7, 0xC1C1C1C1, 0x838F8F8F, 0x81818181, 0x831F1F1F, 0x81818181, 0x013F3F3F, 0x01010101,
+  0xE0FCFCFF, 0xE0E0E0E0, 0xF0F8F8FF, 0xE1E1E1E1, 0xF1F1F1FF, 0xE1E1E1E1, 0xE3E3E3FF, 0xE3E3E3E3,
+  0xC7C7C7FF, 0xC3C3C3C3, 0x878F8FFF, 0xC3C3C3C3, 0x031F1FFF, 0x83838383, 0x013F3FFF, 0x01010101,
+  0xE0FCFFFF, 0xE0E3E0E0, 0xF0F8FFFF, 0xF1F7F1E0, 0xF1F1FFFF, 0xF3FFF3E1, 0x00000000, 0x00000000,
+  0xC7C7FFFF, 0xE7FFE7C3, 0x878FFFFF, 0xC7F7C783, 0x031FFFFF, 0x83E38303, 0x013FFFFF, 0x01C10101,
+  0xE0FFFFFF, 0xE3E2E0E0, 0xF0FFFFFF, 0xFFF5F0E0, 0xF1FFFFFF, 0xFFFBF1E1, 0xE3FFFFFF, 0xFFF7E3E3,
+  0xC7FFFFFF, 0xFFEFC7C3, 0x87FFFFFF, 0xFFD78783, 0x03FFFFFF, 0xE3A30303, 0x01FFFFFF, 0xC1410101,
+  0xE1FFFFFF, 0xE3E0E0E0, 0xF3FFFFFF, 0xFFF0F0E0, 0xF7FFFFFF, 0xFFF1F1E1, 0xF7FFFFFF, 0xFFE3E3E3,
+  0xF7FFFFFF, 0xFFC7C7C3, 0xE7FFFFFF, 0xFF878783, 0xC3FFFFFF, 0xE3030303, 0x81FFFFFF, 0xC1010101,
+  0xE1FFFFFF, 0xE0E0E0E0, 0xE3FFFFFF, 0xF8F0F0E1, 0xE3FFFFFF, 0xF1F1F1E3, 0xE3FFFFFF, 0xE3E3E3E3,
+  0xE3FFFFFF, 0xC7C7C7E3, 0xE3FFFFFF, 0x8F8787C3, 0xC3FFFFFF, 0x03030383, 0x81FFFFFF, 0x01010101,
+  0xC0FFFFFF, 0xE0E0E0C0, 0xC1FFFFFF, 0xF0F0E1C1, 0xC1FFFFFF, 0xF1F1E3C1, 0xC1FFFFFF, 0xE3E3E3C1,
+  0xC1FFFFFF, 0xC7C7E3C1, 0xC1FFFFFF, 0x8787C3C1, 0x81FFFFFF, 0x03038381, 0x01FFFFFF, 0x01010101,
+  0xFFFFFCFC, 0xF0F0F0F0, 0xFFFFF8F8, 0xF0F0F0F0, 0xFFFFF1F1, 0xF0F0F0F0, 0xFFFFE3E3, 0xF0F0F0F0,
+  0xFFFFC7C7, 0xF0F0F0F0, 0xFFFF8F8F, 0xF0F0F0F0, 0xFFFF1F1F, 0xF0F0F0F0, 0xFFFF3F3F, 0xF0F0F0F0,
+  0xFFFCFCFC, 0xF0F0F0F0, 0xFFF8F8F8, 0xF0F0F0F0, 0xFFF1F1F1, 0xF0F0F0F0, 0xFFE3E3E3, 0xF0F0F0F0,
+  0xFFC7C7C7, 0xF0F0F0F0, 0xFF8F8F8F, 0xF0F0F0F0, 0xFF1F1F1F, 0xF0F0F0F0, 0xFF3F3F3F, 0xF0F0F0F0,
+  0xFCFCFCFF, 0xF0F0F0F0, 0xF8F8F8FF, 0xF0F0F0F0, 0xF1F1F1FF, 0xF0F0F0F0, 0xE3E3E3FF, 0xF0F0F0F0,
+  0xC7C7C7FF, 0xF0F0F0F0, 0x8F8F8FFF, 0xF0F0F0F0, 0x1F1F1FFF, 0xF0F0F0F0, 0x3F3F3FFF, 0xF0F0F0F0,
+  0xFCFCFFFF, 0xF0F0F0F8, 0xF8F8FFFF, 0xF0F0F0F8, 0xF1F1FFFF, 0xF0F0F0F0, 0xE3E3FFFF, 0xF0F0F0E0,
+  0xC7C7FFFF, 0xF0F0F0C0, 0x8F8FFFFF, 0xF0F0F080, 0x1F1FFFFF, 0xF0F0F010, 0x3F3FFFFF, 0xF0F0F030,
+  0x00000000, 0x00000000, 0xF8FFFFFF, 0xF0F0F8F8, 0xF1FFFFFF, 0xF0F0F0F0, 0xE3FFFFFF, 0xF0F0E0E0,
+  0xC7FFFFFF, 0xF0F0C0C0, 0x8FFFFFFF, 0xF0F08080, 0x1FFFFFFF, 0xF0F01010, 0x3FFFFFFF, 0xF0F03030,
+  0xFFFFFFFF, 0xF8F8F8FC, 0xFFFFFFFF, 0xF8F8F8F8, 0xFFFFFFFF, 0xF8F0F0F0, 0xFFFFFFFF, 0xF0E0E0E0,
+  0xFFFFFFFF, 0xF0C0C0C0, 0xFFFFFFFF, 0xF0808080, 0xFFFFFFFF, 0xF0101010, 0xFFFFFFFF, 0xF0303030,
+  0xFFFFFFFF, 0xF8F8F8FE, 0xFFFFFFFF, 0xF8F8F8FE, 0xFFFFFFFF, 0xF0F0F0FC, 0xFFFFFFFF, 0xE0E0E0F8,
+  0xFFFFFFFF, 0xC0C0C0F0, 0xFFFFFFFF, 0x808080F0, 0xFFFFFFFF, 0x101010F0, 0xFFFFFFFF, 0x303030F0,
+  0xFFFFFFFF, 0xF8F8F8FC, 0xFFFFFFFF, 0xF8F8FCFC, 0xFFFFFFFF, 0xF0F0F8FC, 0xFFFFFFFF, 0xE0E0F0F8,
+  0xFFFFFFFF, 0xC0C0F0F0, 0xFFFFFFFF, 0x8080F0F0, 0xFFFFFFFF, 0x1010F0F0, 0xFFFFFFFF, 0x3030F0F0,
+  0xFFFFFCFC, 0xE0E0E0E0, 0xFFFFF8F8, 0xE0E0E0E0, 0xFFFFF1F1, 0xE0E0E0E0, 0xFFFFE3E3, 0xE0E0E0E0,
+  0xFFFFC7C7, 0xE0E0E0E0, 0xFFFF8F8F, 0xE0E0E0E0, 0xFFFF1F1F, 0xE0E0E0E0, 0xFFFF3F3F, 0xE0E0E0E0,
+  0xFFFCFCFC, 0xE0E0E0E0, 0xFFF8F8F8, 0xE0E0E0E0, 0xFFF1F1F1, 0xE0E0E0E0, 0xFFE3E3E3, 0xE0E0E0E0,
+  0xFFC7C7C7, 0xE0E0E0E0, 0xFF8F8F8F, 0xE0E0E0E0, 0xFF1F1F1F, 0xE0E0E0E0, 0xFF3F3F3F, 0xE0E0E0E0,
+  0xFCFCFCFF, 0xF0F0F0F8, 0xF8F8F8FF, 0xF0F0F0F8, 0xF1F1F1FF, 0xF0F0F0F8, 0xE3E3E3FF, 0xE0E0E0E0,
+  0xC7C7C7FF, 0xE0E0E0E0, 0x8F8F8FFF, 0xE0E0E0E0, 0x1F1F1FFF, 0xE0E0E0E0, 0x3F3F3FFF, 0xE0E0E0E0,
+  0xFCFCFFFF, 0xF8F8F8FC, 0xF8F8FFFF, 0xF8F8F8F8, 0xF1F1FFFF, 0xF0F0F0F1, 0xE3E3FFFF, 0xF0F0F0E1,
+  0xC7C7FFFF, 0xF0F0E0C0, 0x8F8FFFFF, 0xE0E0E080, 0x1F1FFFFF, 0xE0E0E000, 0x3F3FFFFF, 0xE0E0E020,
+  0xFCFFFFFF, 0xFFFCF8FC, 0x00000000, 0x00000000, 0xF1FFFFFF, 0xFFF9F0F1, 0xE3FFFFFF, 0xFFF9E0E1,
+  0xC7FFFFFF, 0xF8F0C0C0, 0x8FFFFFFF, 0xF0E08080, 0x1FFFFFFF, 0xE0E00000, 0x3FFFFFFF, 0xE0E02020,
+  0xFFFFFFFF, 0xFFFCF8FC, 0xFFFFFFFF, 0xFFF8F8F8, 0xFFFFFFFF, 0xFFF1F0F1, 0xFFFFFFFF, 0xFFE1E0E1,
+  0xFFFFFFFF, 0xF8C0C0C0, 0xFFFFFFFF, 0xF0808080, 0xFFFFFFFF, 0xE0000000, 0xFFFFFFFF, 0xE0202020,
+  0xFFFFFFFF, 0xFCFCF8FD, 0xFFFFFFFF, 0xF8F8F8FD, 0xFFFFFFFF, 0xF1F1F0FD, 0xFFFFFFFF, 0xE3E1E0F9,
+  0xFFFFFFFF, 0xC0C0C0F0, 0xFFFFFFFF, 0x808080E0, 0xFFFFFFFF, 0x000000E0, 0xFFFFFFFF, 0x202020E0,
+  0xFFFFFFFF, 0xFCFCF8F8, 0xFFFFFFFF, 0xF8F8F8F8, 0xFFFFFFFF, 0xF1F1F8F8, 0xFFFFFFFF, 0xE1E1F0F8,
+  0xFFFFFFFF, 0xC0C0E0F0, 0xFFFFFFFF, 0x8080E0E0, 0xFFFFFFFF, 0x0000E0E0, 0xFFFFFFFF, 0x2020E0E0,
+  0xFFFFFCFC, 0xC0C0C0C0, 0xFFFFF8F8, 0xC0C0C0C0, 0xFFFFF1F1, 0xC0C0C0C0, 0xFFFFE3E3, 0xC0C0C0C0,
+  0xFFFFC7C7, 0xC0C0C0C0, 0xFFFF8F8F, 0xC0C0C0C0, 0xFFFF1F1F, 0xC0C0C0C0, 0xFFFF3F3F, 0xC0C0C0C0,
+  0xFFFCFCFC, 0xC0C0C0C0, 0xFFF8F8F8, 0xC0C0C0C0, 0xFFF1F1F1, 0xC0C0C0C0, 0xFFE3E3E3, 0xC0C0C0C0,
+  0xFFC7C7C7, 0xC0C0C0C0, 0xFF8F8F8F, 0xC0C0C0C0, 0xFF1F1F1F, 0xC0C0C0C0, 0xFF3F3F3F, 0xC0C0C0C0,
+  0xFCFCFCFF, 0xE0E0E0F0, 0xF8F8F8FF, 0xE0E0E0F1, 0xF1F1F1FF, 0xE0E0E0F1, 0xE3E3E3FF, 0xE0E0E0F1,
+  0xC7C7C7FF, 0xC0C0C0C1, 0x8F8F8FFF, 0xC0C0C0C1, 0x1F1F1FFF, 0xC0C0C0C0, 0x3F3F3FFF, 0xC0C0C0C0,
+  0xFCFCFFFF, 0xF0F0F0F8, 0xF8F8FFFF, 0xF0F0F0F8, 0xF1F1FFFF, 0xF1F1F1F1, 0xE3E3FFFF, 0xE1E1E1E3,
+  0xC7C7FFFF, 0xE1E1E1C3, 0x8F8FFFFF, 0xE1E1C181, 0x1F1FFFFF, 0xC0C0C000, 0x3F3FFFFF, 0xC0C0C000,
+  0xFCFFFFFF, 0xFFF9F0F8, 0xF8FFFFFF, 0xFFF9F0F8, 0x00000000, 0x00000000, 0xE3FFFFFF, 0xFFF3E1E3,
+  0xC7FFFFFF, 0xFFF3C1C3, 0x8FFFFFFF, 0xF1E18181, 0x1FFFFFFF, 0xE0C00000, 0x3FFFFFFF, 0xC0C00000,
+  0xFFFFFFFF, 0xFFF8F0F8, 0xFFFFFFFF, 0xFFF8F0F8, 0xFFFFFFFF, 0xFFF1F1F1, 0xFFFFFFFF, 0xFFE3E1E3,
+  0xFFFFFFFF, 0xFFC3C1C3, 0xFFFFFFFF, 0xF1818181, 0xFFFFFFFF, 0xE0000000, 0xFFFFFFFF, 0xC0000000,
+  0xFFFFFFFF, 0xFCF8F0F9, 0xFFFFFFFF, 0xF8F8F0FB, 0xFFFFFFFF, 0xF1F1F1FB, 0xFFFFFFFF, 0xE3E3E1FB,
+  0xFFFFFFFF, 0xC7C3C1F3, 0xFFFFFFFF, 0x818181E1, 0xFFFFFFFF, 0x000000C0, 0xFFFFFFFF, 0x000000C0,
+  0xFFFFFFFF, 0xF8F8F0F1, 0xFFFFFFFF, 0xF8F8F1F1, 0xFFFFFFFF, 0xF1F1F1F1, 0xFFFFFFFF, 0xE3E3F1F1,
+  0xFFFFFFFF, 0xC3C3E1F1, 0xFFFFFFFF, 0x8181C1E1, 0xFFFFFFFF, 0x0000C0C0, 0xFFFFFFFF, 0x0000C0C0,
+  0xFFFFFCFC, 0x80808080, 0xFFFFF8F8, 0x80808080, 0xFFFFF1F1, 0x80808080, 0xFFFFE3E3, 0x80808080,
+  0xFFFFC7C7, 0x80808080, 0xFFFF8F8F, 0x80808080, 0xFFFF1F1F, 0x80808080, 0xFFFF3F3F, 0x80808080,
+  0xFFFCFCFC, 0x80808080, 0xFFF8F8F8, 0x80808080, 0xFFF1F1F1, 0x80808080, 0xFFE3E3E3, 0x80808080,
+  0xFFC7C7C7, 0x80808080, 0xFF8F8F8F, 0x80808080, 0xFF1F1F1F, 0x80808080, 0xFF3F3F3F, 0x80808080,
+  0xFCFCFCFF, 0xC0C0C0E0, 0xF8F8F8FF, 0xC0C0C0E0, 0xF1F1F1FF, 0xC1C1C1E3, 0xE3E3E3FF, 0xC1C1C1E3,
+  0xC7C7C7FF, 0xC1C1C1E3, 0x8F8F8FFF, 0x81818183, 0x1F1F1FFF, 0x81818183, 0x3F3F3FFF, 0x81818181,
+  0xFCFCFFFF, 0xE1E1E0E0, 0xF8F8FFFF, 0xE1E1E1F0, 0xF1F1FFFF, 0xE1E1E1F1, 0xE3E3FFFF, 0xE3E3E3E3,
+  0xC7C7FFFF, 0xC3C3C3C7, 0x8F8FFFFF, 0xC3C3C387, 0x1F1FFFFF, 0xC3C38303, 0x3F3FFFFF, 0x81818101,
+  0xFCFFFFFF, 0xE3E1E0E0, 0xF8FFFFFF, 0xFFF3E0F0, 0xF1FFFFFF, 0xFFF3E1F1, 0x00000000, 0x00000000,
+  0xC7FFFFFF, 0xFFE7C3C7, 0x8FFFFFFF, 0xFFE78387, 0x1FFFFFFF, 0xE3C30303, 0x3FFFFFFF, 0xC1810101,
+  0xFFFFFFFF, 0xE3E0E0E0, 0xFFFFFFFF, 0xFFF0E0F0, 0xFFFFFFFF, 0xFFF1E1F1, 0xFFFFFFFF, 0xFFE3E3E3,
+  0xFFFFFFFF, 0xFFC7C3C7, 0xFFFFFFFF, 0xFF878387, 0xFFFFFFFF, 0xE3030303, 0xFFFFFFFF, 0xC1010101,
+  0xFFFFFFFF, 0xE0E0E0E1, 0xFFFFFFFF, 0xF8F0E0F3, 0xFFFFFFFF, 0xF1F1E1F7, 0xFFFFFFFF, 0xE3E3E3F7,
+  0xFFFFFFFF, 0xC7C7C3F7, 0xFFFFFFFF, 0x8F8783E7, 0xFFFFFFFF, 0x030303C3, 0xFFFFFFFF, 0x01010181,
+  0xFFFFFFFF, 0xE0E0E0E1, 0xFFFFFFFF, 0xF0F0E1E3, 0xFFFFFFFF, 0xF1F1E3E3, 0xFFFFFFFF, 0xE3E3E3E3,
+  0xFFFFFFFF, 0xC7C7E3E3, 0xFFFFFFFF, 0x8787C3E3, 0xFFFFFFFF, 0x030383C3, 0xFFFFFFFF, 0x01018181,
+  0xFFFFFCFC, 0xF8F8F8FF, 0xFFFFF8F8, 0xF8F8F8FF, 0xFFFFF1F1, 0xF8F8F8FF, 0xFFFFE3E3, 0xF8F8F8FF,
+  0xFFFFC7C7, 0xF8F8F8FF, 0xFFFF8F8F, 0xF8F8F8FF, 0xFFFF1F1F, 0xF8F8F8FF, 0xFFFF3F3F, 0xF8F8F8FF,
+  0xFFFCFCFC, 0xF8F8F8FF, 0xFFF8F8F8, 0xF8F8F8FF, 0xFFF1F1F1, 0xF8F8F8FF, 0xFFE3E3E3, 0xF8F8F8FF,
+  0xFFC7C7C7, 0xF8F8F8FF, 0xFF8F8F8F, 0xF8F8F8FF, 0xFF1F1F1F, 0xF8F8F8FF, 0xFF3F3F3F, 0xF8F8F8FF,
+  0xFCFCFCFF, 0xF8F8F8FF, 0xF8F8F8FF, 0xF8F8F8FF, 0xF1F1F1FF, 0xF8F8F8FF, 0xE3E3E3FF, 0xF8F8F8FF,
+  0xC7C7C7FF, 0xF8F8F8FF, 0x8F8F8FFF, 0xF8F8F8FF, 0x1F1F1FFF, 0xF8F8F8FF, 0x3F3F3FFF, 0xF8F8F8FF,
+  0xFCFCFFFF, 0xF8F8F8FC, 0xF8F8FFFF, 0xF8F8F8F8, 0xF1F1FFFF, 0xF8F8F8F1, 0xE3E3FFFF, 0xF8F8F8E3,
+  0xC7C7FFFF, 0xF8F8F8C7, 0x8F8FFFFF, 0xF8F8F88F, 0x1F1FFFFF, 0xF8F8F81F, 0x3F3FFFFF, 0xF8F8F83F,
+  0xFCFFFFFF, 0xF8F8F8FC, 0xF8FFFFFF, 0xF8F8F8F8, 0xF1FFFFFF, 0xF8F8F0F1, 0xE3FFFFFF, 0xF8F8E0E3,
+  0xC7FFFFFF, 0xF8F8C0C7, 0x8FFFFFFF, 0xF8F8888F, 0x1FFFFFFF, 0xF8F8181F, 0x3FFFFFFF, 0xF8F8383F,
+  0x00000000, 0x00000000, 0xFFFFFFFF, 0xFCF8F8F8, 0xFFFFFFFF, 0xFCF0F0F1, 0xFFFFFFFF, 0xF8E0E0E3,
+  0xFFFFFFFF, 0xF8C0C0C7, 0xFFFFFFFF, 0xF888888F, 0xFFFFFFFF, 0xF818181F, 0xFFFFFFFF, 0xF838383F,
+  0xFFFFFFFF, 0xF8F8FCFF, 0xFFFFFFFF, 0xF8F8F8FF, 0xFFFFFFFF, 0xF0F0F0FF, 0xFFFFFFFF, 0xE0E0E0FF,
+  0xFFFFFFFF, 0xC0C0C0FF, 0xFFFFFFFF, 0x888888FF, 0xFFFFFFFF, 0x181818FF, 0xFFFFFFFF, 0x383838FF,
+  0xFFFFFFFF, 0xF8F8FCFF, 0xFFFFFFFF, 0xF8F8FEFF, 0xFFFFFFFF, 0xF0F0FCFF, 0xFFFFFFFF, 0xE0E0F8FF,
+  0xFFFFFFFF, 0xC0C0F8FF, 0xFFFFFFFF, 0x8888F8FF, 0xFFFFFFFF, 0x1818F8FF, 0xFFFFFFFF, 0x3838F8FF,
+  0xFFFFFCFC, 0xF0F0F0FF, 0xFFFFF8F8, 0xF0F0F0FF, 0xFFFFF1F1, 0xF0F0F0FF, 0xFFFFE3E3, 0xF0F0F0FF,
+  0xFFFFC7C7, 0xF0F0F0FF, 0xFFFF8F8F, 0xF0F0F0FF, 0xFFFF1F1F, 0xF0F0F0FF, 0xFFFF3F3F, 0xF0F0F0FF,
+  0xFFFCFCFC, 0xF0F0F0FF, 0xFFF8F8F8, 0xF0F0F0FF, 0xFFF1F1F1, 0xF0F0F0FF, 0xFFE3E3E3, 0xF0F0F0FF,
+  0xFFC7C7C7, 0xF0F0F0FF, 0xFF8F8F8F, 0xF0F0F0FF, 0xFF1F1F1F, 0xF0F0F0FF, 0xFF3F3F3F, 0xF0F0F0FF,
+  0xFCFCFCFF, 0xF0F0F0FF, 0xF8F8F8FF, 0xF0F0F0FF, 0xF1F1F1FF, 0xF0F0F0FF, 0xE3E3E3FF, 0xF0F0F0FF,
+  0xC7C7C7FF, 0xF0F0F0FF, 0x8F8F8FFF, 0xF0F0F0FF, 0x1F1F1FFF, 0xF0F0F0FF, 0x3F3F3FFF, 0xF0F0F0FF,
+  0xFCFCFFFF, 0xF8F8F8FC, 0xF8F8FFFF, 0xF8F8F8F8, 0xF1F1FFFF, 0xF8F8F8F1, 0xE3E3FFFF, 0xF8F8F0E3,
+  0xC7C7FFFF, 0xF8F8F0C7, 0x8F8FFFFF, 0xF0F0F08F, 0x1F1FFFFF, 0xF0F0F01F, 0x3F3FFFFF, 0xF0F0F03F,
+  0xFCFFFFFF, 0xFDF8FCFC, 0xF8FFFFFF, 0xFDF8F8F8, 0xF1FFFFFF, 0xFDF8F1F1, 0xE3FFFFFF, 0xFDF8E1E3,
+  0xC7FFFFFF, 0xF8F8C0C7, 0x8FFFFFFF, 0xF0F0808F, 0x1FFFFFFF, 0xF0F0101F, 0x3FFFFFFF, 0xF0F0303F,
+  0xFFFFFFFF, 0xFEF8FCFC, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFAF0F1F1, 0xFFFFFFFF, 0xFDE0E1E3,
+  0xFFFFFFFF, 0xF8C0C0C7, 0xFFFFFFFF, 0xF080808F, 0xFFFFFFFF, 0xF010101F, 0xFFFFFFFF, 0xF030303F,
+  0xFFFFFFFF, 0xFCF8FCFF, 0xFFFFFFFF, 0xF8F8F8FF, 0xFFFFFFFF, 0xF1F0F1FF, 0xFFFFFFFF, 0xE1E0E1FF,
+  0xFFFFFFFF, 0xC0C0C0FF, 0xFFFFFFFF, 0x808080FF, 0xFFFFFFFF, 0x101010FF, 0xFFFFFFFF, 0x303030FF,
+  0xFFFFFFFF, 0xFCF8FDFF, 0xFFFFFFFF, 0xF8F8FDFF, 0xFFFFFFFF, 0xF1F0FDFF, 0xFFFFFFFF, 0xE0E0F9FF,
+  0xFFFFFFFF, 0xC0C0F0FF, 0xFFFFFFFF, 0x8080F0FF, 0xFFFFFFFF, 0x1010F0FF, 0xFFFFFFFF, 0x3030F0FF,
+  0xFFFFFCFC, 0xE0E0E0FF, 0xFFFFF8F8, 0xE0E0E0FF, 0xFFFFF1F1, 0xE0E0E0FF, 0xFFFFE3E3, 0xE0E0E0FF,
+  0xFFFFC7C7, 0xE0E0E0FF, 0xFFFF8F8F, 0xE0E0E0FF, 0xFFFF1F1F, 0xE0E0E0FF, 0xFFFF3F3F, 0xE0E0E0FF,
+  0xFFFCFCFC, 0xE0E0E0FF, 0xFFF8F8F8, 0xE0E0E0FF, 0xFFF1F1F1, 0xE0E0E0FF, 0xFFE3E3E3, 0xE0E0E0FF,
+  0xFFC7C7C7, 0xE0E0E0FF, 0xFF8F8F8F, 0xE0E0E0FF, 0xFF1F1F1F, 0xE0E0E0FF, 0xFF3F3F3F, 0xE0E0E0FF,
+  0xFCFCFCFF, 0xE0E0E0FF, 0xF8F8F8FF, 0xE0E0E0FF, 0xF1F1F1FF, 0xE0E0E0FF, 0xE3E3E3FF, 0xE0E0E0FF,
+  0xC7C7C7FF, 0xE0E0E0FF, 0x8F8F8FFF, 0xE0E0E0FF, 0x1F1F1FFF, 0xE0E0E0FF, 0x3F3F3FFF, 0xE0E0E0FF,
+  0xFCFCFFFF, 0xF1F1F0FC, 0xF8F8FFFF, 0xF1F1F1F8, 0xF1F1FFFF, 0xF1F1F1F1, 0xE3E3FFFF, 0xF1F1F1E3,
+  0xC7C7FFFF, 0xF1F1E1C7, 0x8F8FFFFF, 0xF1F1E18F, 0x1F1FFFFF, 0xE0E0E01F, 0x3F3FFFFF, 0xE0E0E03F,
+  0xFCFFFFFF, 0xFBF1F8FC, 0xF8FFFFFF, 0xFBF1F8F8, 0xF1FFFFFF, 0xFBF1F1F1, 0xE3FFFFFF, 0xFBF1E3E3,
+  0xC7FFFFFF, 0xFBF1C3C7, 0x8FFFFFFF, 0xF1F1818F, 0x1FFFFFFF, 0xE0E0001F, 0x3FFFFFFF, 0xE0E0203F,
+  0xFFFFFFFF, 0xFBF0F8FC, 0xFFFFFFFF, 0xFDF0F8F8, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xF7E1E3E3,
+  0xFFFFFFFF, 0xFBC1C3C7, 0xFFFFFFFF, 0xF181818F, 0xFFFFFFFF, 0xE000001F, 0xFFFFFFFF, 0xE020203F,
+  0xFFFFFFFF, 0xF8F0F8FF, 0xFFFFFFFF, 0xF8F0F8FF, 0xFFFFFFFF, 0xF1F1F1FF, 0xFFFFFFFF, 0xE3E1E3FF,
+  0xFFFFFFFF, 0xC3C1C3FF, 0xFFFFFFFF, 0x818181FF, 0xFFFFFFFF, 0x000000FF, 0xFFFFFFFF, 0x202020FF,
+  0xFFFFFFFF, 0xF8F0F9FF, 0xFFFFFFFF, 0xF8F0FBFF, 0xFFFFFFFF, 0xF1F1FBFF, 0xFFFFFFFF, 0xE3E1FBFF,
+  0xFFFFFFFF, 0xC3C1F3FF, 0xFFFFFFFF, 0x8181E1FF, 0xFFFFFFFF, 0x0000E0FF, 0xFFFFFFFF, 0x2020E0FF,
+  0xFFFFFCFC, 0xC1C1C1FF, 0xFFFFF8F8, 0xC1C1C1FF, 0xFFFFF1F1, 0xC1C1C1FF, 0xFFFFE3E3, 0xC1C1C1FF,
+  0xFFFFC7C7, 0xC1C1C1FF, 0xFFFF8F8F, 0xC1C1C1FF, 0xFFFF1F1F, 0xC1C1C1FF, 0xFFFF3F3F, 0xC1C1C1FF,
+  0xFFFCFCFC, 0xC1C1C1FF, 0xFFF8F8F8, 0xC1C1C1FF, 0xFFF1F1F1, 0xC1C1C1FF, 0xFFE3E3E3, 0xC1C1C1FF,
+  0xFFC7C7C7, 0xC1C1C1FF, 0xFF8F8F8F, 0xC1C1C1FF, 0xFF1F1F1F, 0xC1C1C1FF, 0xFF3F3F3F, 0xC1C1C1FF,
+  0xFCFCFCFF, 0xC1C1C1FF, 0xF8F8F8FF, 0xC1C1C1FF, 0xF1F1F1FF, 0xC1C1C1FF, 0xE3E3E3FF, 0xC1C1C1FF,
+  0xC7C7C7FF, 0xC1C1C1FF, 0x8F8F8FFF, 0xC1C1C1FF, 0x1F1F1FFF, 0xC1C1C1FF, 0x3F3F3FFF, 0xC1C1C1FF,
+  0xFCFCFFFF, 0xE3E3E1FC, 0xF8F8FFFF, 0xE3E3E1F8, 0xF1F1FFFF, 0xE3E3E3F1, 0xE3E3FFFF, 0xE3E3E3E3,
+  0xC7C7FFFF, 0xE3E3E3C7, 0x8F8FFFFF, 0xE3E3C38F, 0x1F1FFFFF, 0xE3E3C31F, 0x3F3FFFFF, 0xC1C1C13F,
+  0xFCFFFFFF, 0xE3E3E0FC, 0xF8FFFFFF, 0xF7E3F0F8, 0xF1FFFFFF, 0xF7E3F1F1, 0xE3FFFFFF, 0xF7E3E3E3,
+  0xC7FFFFFF, 0xF7E3C7C7, 0x8FFFFFFF, 0xF7E3878F, 0x1FFFFFFF, 0xE3E3031F, 0x3FFFFFFF, 0xC1C1013F,
+  0xFFFFFFFF, 0xE3E0E0FC, 0xFFFFFFFF, 0xF7E0F0F8, 0xFFFFFFFF, 0xFBE1F1F1, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xEFC3C7C7, 0xFFFFFFFF, 0xF783878F, 0xFFFFFFFF, 0xE303031F, 0xFFFFFFFF, 0xC101013F,
+  0xFFFFFFFF, 0xE0E0E0FF, 0xFFFFFFFF, 0xF0E0F0FF, 0xFFFFFFFF, 0xF1E1F1FF, 0xFFFFFFFF, 0xE3E3E3FF,
+  0xFFFFFFFF, 0xC7C3C7FF, 0xFFFFFFFF, 0x878387FF, 0xFFFFFFFF, 0x030303FF, 0xFFFFFFFF, 0x010101FF,
+  0xFFFFFFFF, 0xE0E0E1FF, 0xFFFFFFFF, 0xF0E0F3FF, 0xFFFFFFFF, 0xF1E1F7FF, 0xFFFFFFFF, 0xE3E3F7FF,
+  0xFFFFFFFF, 0xC7C3F7FF, 0xFFFFFFFF, 0x8783E7FF, 0xFFFFFFFF, 0x0303C3FF, 0xFFFFFFFF, 0x0101C1FF,
+  0xFFFFFCFC, 0xFCFCFFFF, 0xFFFFF8F8, 0xFCFCFFFF, 0xFFFFF1F1, 0xFCFCFFFF, 0xFFFFE3E3, 0xFCFCFFFF,
+  0xFFFFC7C7, 0xFCFCFFFF, 0xFFFF8F8F, 0xFCFCFFFF, 0xFFFF1F1F, 0xFCFCFFFF, 0xFFFF3F3F, 0xFCFCFFFF,
+  0xFFFCFCFC, 0xFCFCFFFF, 0xFFF8F8F8, 0xFCFCFFFF, 0xFFF1F1F1, 0xFCFCFFFF, 0xFFE3E3E3, 0xFCFCFFFF,
+  0xFFC7C7C7, 0xFCFCFFFF, 0xFF8F8F8F, 0xFCFCFFFF, 0xFF1F1F1F, 0xFCFCFFFF, 0xFF3F3F3F, 0xFCFCFFFF,
+  0xFCFCFCFF, 0xFCFCFFFF, 0xF8F8F8FF, 0xFCFCFFFF, 0xF1F1F1FF, 0xFCFCFFFF, 0xE3E3E3FF, 0xFCFCFFFF,
+  0xC7C7C7FF, 0xFCFCFFFF, 0x8F8F8FFF, 0xFCFCFFFF, 0x1F1F1FFF, 0xFCFCFFFF, 0x3F3F3FFF, 0xFCFCFFFF,
+  0xFCFCFFFF, 0xFCFCFFFC, 0xF8F8FFFF, 0xFCFCFFF8, 0xF1F1FFFF, 0xFCFCFFF1, 0xE3E3FFFF, 0xFCFCFFE3,
+  0xC7C7FFFF, 0xFCFCFFC7, 0x8F8FFFFF, 0xFCFCFF8F, 0x1F1FFFFF, 0xFCFCFF1F, 0x3F3FFFFF, 0xFCFCFF3F,
+  0xFCFFFFFF, 0xFCFCFCFC, 0xF8FFFFFF, 0xFCFCF8F8, 0xF1FFFFFF, 0xFCFCF1F1, 0xE3FFFFFF, 0xFCFCE3E3,
+  0xC7FFFFFF, 0xFCFCC7C7, 0x8FFFFFFF, 0xFCFC8F8F, 0x1FFFFFFF, 0xFCFC1F1F, 0x3FFFFFFF, 0xFCFC3F3F,
+  0xFFFFFFFF, 0xFCFCFCFC, 0xFFFFFFFF, 0xFCF8F8F8, 0xFFFFFFFF, 0xFCF0F1F1, 0xFFFFFFFF, 0xFCE0E3E3,
+  0xFFFFFFFF, 0xFCC4C7C7, 0xFFFFFFFF, 0xFC8C8F8F, 0xFFFFFFFF, 0xFC1C1F1F, 0xFFFFFFFF, 0xFC3C3F3F,
+  0x00000000, 0x00000000, 0xFFFFFFFF, 0xF8F8F8FF, 0xFFFFFFFF, 0xF0F0F1FF, 0xFFFFFFFF, 0xE0E0E3FF,
+  0xFFFFFFFF, 0xC4C4C7FF, 0xFFFFFFFF, 0x8C8C8FFF, 0xFFFFFFFF, 0x1C1C1FFF, 0xFFFFFFFF, 0x3C3C3FFF,
+  0xFFFFFFFF, 0xF8F8FFFF, 0xFFFFFFFF, 0xF8F8FFFF, 0xFFFFFFFF, 0xF0F0FFFF, 0xFFFFFFFF, 0xE0E0FFFF,
+  0xFFFFFFFF, 0xC4C4FFFF, 0xFFFFFFFF, 0x8C8CFFFF, 0xFFFFFFFF, 0x1C1CFFFF, 0xFFFFFFFF, 0x3C3CFFFF,
+  0xFFFFFCFC, 0xF8F8FFFF, 0xFFFFF8F8, 0xF8F8FFFF, 0xFFFFF1F1, 0xF8F8FFFF, 0xFFFFE3E3, 0xF8F8FFFF,
+  0xFFFFC7C7, 0xF8F8FFFF, 0xFFFF8F8F, 0xF8F8FFFF, 0xFFFF1F1F, 0xF8F8FFFF, 0xFFFF3F3F, 0xF8F8FFFF,
+  0xFFFCFCFC, 0xF8F8FFFF, 0xFFF8F8F8, 0xF8F8FFFF, 0xFFF1F1F1, 0xF8F8FFFF, 0xFFE3E3E3, 0xF8F8FFFF,
+  0xFFC7C7C7, 0xF8F8FFFF, 0xFF8F8F8F, 0xF8F8FFFF, 0xFF1F1F1F, 0xF8F8FFFF, 0xFF3F3F3F, 0xF8F8FFFF,
+  0xFCFCFCFF, 0xF8F8FFFF, 0xF8F8F8FF, 0xF8F8FFFF, 0xF1F1F1FF, 0xF8F8FFFF, 0xE3E3E3FF, 0xF8F8FFFF,
+  0xC7C7C7FF, 0xF8F8FFFF, 0x8F8F8FFF, 0xF8F8FFFF, 0x1F1F1FFF, 0xF8F8FFFF, 0x3F3F3FFF, 0xF8F8FFFF,
+  0xFCFCFFFF, 0xF8F8FFFC, 0xF8F8FFFF, 0xF8F8FFF8, 0xF1F1FFFF, 0xF8F8FFF1, 0xE3E3FFFF, 0xF8F8FFE3,
+  0xC7C7FFFF, 0xF8F8FFC7, 0x8F8FFFFF, 0xF8F8FF8F, 0x1F1FFFFF, 0xF8F8FF1F, 0x3F3FFFFF, 0xF8F8FF3F,
+  0xFCFFFFFF, 0xFAF8FCFC, 0xF8FFFFFF, 0xFAF8F8F8, 0xF1FFFFFF, 0xFAF8F1F1, 0xE3FFFFFF, 0xFAF8E3E3,
+  0xC7FFFFFF, 0xF8F8C7C7, 0x8FFFFFFF, 0xF8F88F8F, 0x1FFFFFFF, 0xF8F81F1F, 0x3FFFFFFF, 0xF8F83F3F,
+  0xFFFFFFFF, 0xF8FCFCFC, 0xFFFFFFFF, 0xFAF8F8F8, 0xFFFFFFFF, 0xF8F1F1F1, 0xFFFFFFFF, 0xFAE1E3E3,
+  0xFFFFFFFF, 0xF8C0C7C7, 0xFFFFFFFF, 0xF8888F8F, 0xFFFFFFFF, 0xF8181F1F, 0xFFFFFFFF, 0xF8383F3F,
+  0xFFFFFFFF, 0xF8FCFCFF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xF0F1F1FF, 0xFFFFFFFF, 0xE2E1E3FF,
+  0xFFFFFFFF, 0xC0C0C7FF, 0xFFFFFFFF, 0x88888FFF, 0xFFFFFFFF, 0x18181FFF, 0xFFFFFFFF, 0x38383FFF,
+  0xFFFFFFFF, 0xF8FCFFFF, 0xFFFFFFFF, 0xF8F8FFFF, 0xFFFFFFFF, 0xF0F1FFFF, 0xFFFFFFFF, 0xE0E1FFFF,
+  0xFFFFFFFF, 0xC0C0FFFF, 0xFFFFFFFF, 0x8888FFFF, 0xFFFFFFFF, 0x1818FFFF, 0xFFFFFFFF, 0x3838FFFF,
+  0xFFFFFCFC, 0xF1F1FFFF, 0xFFFFF8F8, 0xF1F1FFFF, 0xFFFFF1F1, 0xF1F1FFFF, 0xFFFFE3E3, 0xF1F1FFFF,
+  0xFFFFC7C7, 0xF1F1FFFF, 0xFFFF8F8F, 0xF1F1FFFF, 0xFFFF1F1F, 0xF1F1FFFF, 0xFFFF3F3F, 0xF1F1FFFF,
+  0xFFFCFCFC, 0xF1F1FFFF, 0xFFF8F8F8, 0xF1F1FFFF, 0xFFF1F1F1, 0xF1F1FFFF, 0xFFE3E3E3, 0xF1F1FFFF,
+  0xFFC7C7C7, 0xF1F1FFFF, 0xFF8F8F8F, 0xF1F1FFFF, 0xFF1F1F1F, 0xF1F1FFFF, 0xFF3F3F3F, 0xF1F1FFFF,
+  0xFCFCFCFF, 0xF1F1FFFF, 0xF8F8F8FF, 0xF1F1FFFF, 0xF1F1F1FF, 0xF1F1FFFF, 0xE3E3E3FF, 0xF1F1FFFF,
+  0xC7C7C7FF, 0xF1F1FFFF, 0x8F8F8FFF, 0xF1F1FFFF, 0x1F1F1FFF, 0xF1F1FFFF, 0x3F3F3FFF, 0xF1F1FFFF,
+  0xFCFCFFFF, 0xF1F1FFFC, 0xF8F8FFFF, 0xF1F1FFF8, 0xF1F1FFFF, 0xF1F1FFF1, 0xE3E3FFFF, 0xF1F1FFE3,
+  0xC7C7FFFF, 0xF1F1FFC7, 0x8F8FFFFF, 0xF1F1FF8F, 0x1F1FFFFF, 0xF1F1FF1F, 0x3F3FFFFF, 0xF1F1FF3F,
+  0xFCFFFFFF, 0xF5F1FCFC, 0xF8FFFFFF, 0xF5F1F8F8, 0xF1FFFFFF, 0xF5F1F1F1, 0xE3FFFFFF, 0xF5F1E3E3,
+  0xC7FFFFFF, 0xF5F1C7C7, 0x8FFFFFFF, 0xF1F18F8F, 0x1FFFFFFF, 0xF1F11F1F, 0x3FFFFFFF, 0xF1F13F3F,
+  0xFFFFFFFF, 0xF5F8FCFC, 0xFFFFFFFF, 0xF1F8F8F8, 0xFFFFFFFF, 0xF5F1F1F1, 0xFFFFFFFF, 0xF1E3E3E3,
+  0xFFFFFFFF, 0xF5C3C7C7, 0xFFFFFFFF, 0xF1818F8F, 0xFFFFFFFF, 0xF1111F1F, 0xFFFFFFFF, 0xF1313F3F,
+  0xFFFFFFFF, 0xF4F8FCFF, 0xFFFFFFFF, 0xF0F8F8FF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xE1E3E3FF,
+  0xFFFFFFFF, 0xC5C3C7FF, 0xFFFFFFFF, 0x81818FFF, 0xFFFFFFFF, 0x11111FFF, 0xFFFFFFFF, 0x31313FFF,
+  0xFFFFFFFF, 0xF0F8FFFF, 0xFFFFFFFF, 0xF0F8FFFF, 0xFFFFFFFF, 0xF1F1FFFF, 0xFFFFFFFF, 0xE1E3FFFF,
+  0xFFFFFFFF, 0xC1C3FFFF, 0xFFFFFFFF, 0x8181FFFF, 0xFFFFFFFF, 0x1111FFFF, 0xFFFFFFFF, 0x3131FFFF,
+  0xFFFFFCFC, 0xE3E3FFFF, 0xFFFFF8F8, 0xE3E3FFFF, 0xFFFFF1F1, 0xE3E3FFFF, 0xFFFFE3E3, 0xE3E3FFFF,
+  0xFFFFC7C7, 0xE3E3FFFF, 0xFFFF8F8F, 0xE3E3FFFF, 0xFFFF1F1F, 0xE3E3FFFF, 0xFFFF3F3F, 0xE3E3FFFF,
+  0xFFFCFCFC, 0xE3E3FFFF, 0xFFF8F8F8, 0xE3E3FFFF, 0xFFF1F1F1, 0xE3E3FFFF, 0xFFE3E3E3, 0xE3E3FFFF,
+  0xFFC7C7C7, 0xE3E3FFFF, 0xFF8F8F8F, 0xE3E3FFFF, 0xFF1F1F1F, 0xE3E3FFFF, 0xFF3F3F3F, 0xE3E3FFFF,
+  0xFCFCFCFF, 0xE3E3FFFF, 0xF8F8F8FF, 0xE3E3FFFF, 0xF1F1F1FF, 0xE3E3FFFF, 0xE3E3E3FF, 0xE3E3FFFF,
+  0xC7C7C7FF, 0xE3E3FFFF, 0x8F8F8FFF, 0xE3E3FFFF, 0x1F1F1FFF, 0xE3E3FFFF, 0x3F3F3FFF, 0xE3E3FFFF,
+  0xFCFCFFFF, 0xE3E3FFFC, 0xF8F8FFFF, 0xE3E3FFF8, 0xF1F1FFFF, 0xE3E3FFF1, 0xE3E3FFFF, 0xE3E3FFE3,
+  0xC7C7FFFF, 0xE3E3FFC7, 0x8F8FFFFF, 0xE3E3FF8F, 0x1F1FFFFF, 0xE3E3FF1F, 0x3F3FFFFF, 0xE3E3FF3F,
+  0xFCFFFFFF, 0xE3E3FCFC, 0xF8FFFFFF, 0xEBE3F8F8, 0xF1FFFFFF, 0xEBE3F1F1, 0xE3FFFFFF, 0xEBE3E3E3,
+  0xC7FFFFFF, 0xEBE3C7C7, 0x8FFFFFFF, 0xEBE38F8F, 0x1FFFFFFF, 0xE3E31F1F, 0x3FFFFFFF, 0xE3E33F3F,
+  0xFFFFFFFF, 0xE3E0FCFC, 0xFFFFFFFF, 0xEBF0F8F8, 0xFFFFFFFF, 0xE3F1F1F1, 0xFFFFFFFF, 0xEBE3E3E3,
+  0xFFFFFFFF, 0xE3C7C7C7, 0xFFFFFFFF, 0xEB878F8F, 0xFFFFFFFF, 0xE3031F1F, 0xFFFFFFFF, 0xE3233F3F,
+  0xFFFFFFFF, 0xE0E0FCFF, 0xFFFFFFFF, 0xE8F0F8FF, 0xFFFFFFFF, 0xE1F1F1FF, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xC3C7C7FF, 0xFFFFFFFF, 0x8B878FFF, 0xFFFFFFFF, 0x03031FFF, 0xFFFFFFFF, 0x23233FFF,
+  0xFFFFFFFF, 0xE0E0FFFF, 0xFFFFFFFF, 0xE0F0FFFF, 0xFFFFFFFF, 0xE1F1FFFF, 0xFFFFFFFF, 0xE3E3FFFF,
+  0xFFFFFFFF, 0xC3C7FFFF, 0xFFFFFFFF, 0x8387FFFF, 0xFFFFFFFF, 0x0303FFFF, 0xFFFFFFFF, 0x2323FFFF,
+  0x808080FC, 0x80808080, 0x808080F8, 0x80808080, 0x808080F0, 0x80808080, 0x808080E0, 0x80808080,
+  0x808080C4, 0x80808080, 0x8080808C, 0x80808080, 0x8080001C, 0x80808080, 0x8080003C, 0x80808080,
+  0x00000000, 0x00000000, 0x8080F8F8, 0x80808080, 0x8080F0F0, 0x80808080, 0x8080E0E0, 0x80808080,
+  0x8080C0C4, 0x80808080, 0x8080808C, 0x80808080, 0x8000001C, 0x80808080, 0x8000003C, 0x80808080,
+  0x80F0F0FF, 0x80808080, 0x80F8F8FF, 0x80808080, 0x80F0F0FC, 0x80808080, 0x80E0E0FC, 0x80808080,
+  0x80C0C0FC, 0x80808080, 0x808080FC, 0x80808080, 0x000000FC, 0x80808080, 0x000000FC, 0x80808080,
+  0xF0F0FCFC, 0xC0C0C0C0, 0xF8F8FCFC, 0xC0C0C0C0, 0xF0F0FCFC, 0xC0C0C0C0, 0xE0E0FCFC, 0xC0C0C0C0,
+  0xC0C0F0FC, 0xC0C0C0C0, 0x8080E0FC, 0x80808080, 0x0000C0FC, 0x80808000, 0x000080FC, 0x80808000,
+  0xF0F0FCFC, 0xE0E0E0F0, 0xF8FCFCFC, 0xE0E0E0F8, 0xF0FCFCFC, 0xE0E0E0F0, 0xE0F8FCFC, 0xE0E0E0E0,
+  0xC0F0F0FC, 0xC0C0C0C0, 0x80E0E0FC, 0x80808080, 0x00C0C0FC, 0x80800000, 0x008080FC, 0x80800000,
+  0xF0F0FCFC, 0xF0F0F0F0, 0xF8F8FCFC, 0xF0F0F8F8, 0xF0F0FCFC, 0xF0F0F0F0, 0xE0E0FCFC, 0xE0E0E0E0,
+  0xC0C0F0FC, 0xC0C0C0C0, 0x8080E0FC, 0x80808080, 0x8080C0FC, 0x80000000, 0x808080FC, 0x80000000,
+  0xF0F0F0FC, 0xF0F0F0F0, 0xF0F0F0FC, 0xF8F8F0F0, 0xF0F0F0FC, 0xF0F0F0F0, 0xE0E0E0FC, 0xE0E0E0E0,
+  0xC0C0C0FC, 0xC0C0C0C0, 0x808080FC, 0x80808080, 0x808080FC, 0x00000080, 0x808080FC, 0x00000080,
+  0xE0E0E0FC, 0xF0E0E0E0, 0xE0E0E0FC, 0xF8E0E0E0, 0xE0E0E0FC, 0xF0E0E0E0, 0xE0E0E0FC, 0xE0E0E0E0,
+  0xC0C0C0FC, 0xC0C0C0C0, 0x808080FC, 0x80808080, 0x808080FC, 0x00008080, 0x808080FC, 0x00008080,
+  0xF0F0F8FC, 0xF0F0F0F0, 0xF0F0F8F8, 0xF0F0F0F0, 0xE0E0E0F1, 0xE0E0E0E0, 0xE0E0E0E0, 0xE0E0E0E0,
+  0xC0C0C0C0, 0xC0C0C0C0, 0x80808088, 0x80808080, 0x00000018, 0x00000000, 0x00000038, 0x00000000,
+  0xF8F8FCFC, 0xFFF8F8F8, 0x00000000, 0x00000000, 0xF0F0F1F1, 0xFFF0F0F0, 0xE0E0E0E0, 0xFFE0E0E0,
+  0xC0C0C0C0, 0xFFC0C0C0, 0x80808088, 0xE0808080, 0x00000018, 0xC0000000, 0x00000038, 0x80000000,
+  0xFCFCFCFF, 0xFFFFFCFD, 0xF8F8F8FF, 0xFFFFF8FA, 0xF1F1F1FF, 0xFFFFF1F5, 0xE0E0E0F8, 0xFFFFE0E8,
+  0xC0C0C0F8, 0xFFF0C0D0, 0x808080F8, 0xE0E080A0, 0x000000F8, 0xC0C00040, 0x000000F8, 0x80808080,
+  0xFCF8F8F8, 0xFFFFFFFC, 0xF8F8F8F8, 0xFFFFFFF8, 0xF1F0F8F8, 0xFFFFFFF1, 0xE0E0F8F8, 0xFFFFF8E0,
+  0xC0C0F8F8, 0xFFF0F0C0, 0x8080E0F8, 0xE0E0E080, 0x0000C0F8, 0xC0C0C000, 0x000080F8, 0x80808000,
+  0xF8F8F8F8, 0xFFFFFCFC, 0xF8F8F8F8, 0xFFFFF8F8, 0xF0F8F8F8, 0xFFFFF1F1, 0xE0F8F8F8, 0xFFFFE0E0,
+  0xC0F0F8F8, 0xFFF0C0C0, 0x80E0E0F8, 0xE0E08080, 0x00C0C0F8, 0xC0C00000, 0x008080F8, 0x80800000,
+  0xF0F0F8F8, 0xFFFCFCF0, 0xF0F0F8F8, 0xFFF8F8F0, 0xF0F0F8F8, 0xFFF1F1F0, 0xE0E0F8F8, 0xFFE0E0E0,
+  0xC0C0F8F8, 0xFFC0C0C0, 0x8080E0F8, 0xE0808080, 0x0000C0F8, 0xC0000000, 0x000080F8, 0x80000000,
+  0xE0E0E0F8, 0xFCFCE0E0, 0xE0E0E0F8, 0xF8F8E0E0, 0xE0E0E0F8, 0xF1F1E0E0, 0xE0E0E0F8, 0xE0E0E0E0,
+  0xC0C0C0F8, 0xC0C0C0C0, 0x808080F8, 0x80808080, 0x000000F8, 0x00000000, 0x000000F8, 0x00000000,
+  0xC0C0C0F8, 0xFCC0C0C0, 0xC0C0C0F8, 0xF8C0C0C0, 0xC0C0C0F8, 0xF1C0C0C0, 0xC0C0C0F8, 0xE0C0C0C0,
+  0xC0C0C0F8, 0xC0C0C0C0, 0x808080F8, 0x80808080, 0x000000F8, 0x00000000, 0x000000F8, 0x00000000,
+  0xE0E0F0F0, 0xE0E0E0E0, 0xE0E0F0F8, 0xE0E0E0E0, 0xE0E0F1F1, 0xE0E0E0E0, 0xC0C0C1E3, 0xC0C0C0C0,
+  0xC0C0C1C1, 0xC0C0C0C0, 0x80808181, 0x80808080, 0x00000011, 0x00000000, 0x00000031, 0x00000000,
+  0xF0F0F0F0, 0xFFF0F0F0, 0xF0F0F8F8, 0xFFF0F0F0, 0x00000000, 0x00000000, 0xE1E1E3E3, 0xFFE1E1E1,
+  0xC1C1C1C1, 0xFFC1C1C1, 0x80808181, 0xFF808080, 0x00000011, 0xC0000000, 0x00000031, 0x80000000,
+  0xF0F0F0F1, 0xFFFFF0F1, 0xF8F8F8FF, 0xFFFFF8FA, 0xF1F1F1FF, 0xFFFFF1F5, 0xE3E3E3FF, 0xFFFFE3EB,
+  0xC1C1C1F1, 0xFFFFC1D1, 0x808081F1, 0xFFE080A0, 0x000000F1, 0xC0C00040, 0x000000F1, 0x80800080,
+  0xF0F0F1F1, 0xFFFFF1F0, 0xF8F0F1F1, 0xFFFFFFF8, 0xF1F1F1F1, 0xFFFFFFF1, 0xE3E1F1F1, 0xFFFFFFE3,
+  0xC1C1F1F1, 0xFFFFF1C1, 0x8080F1F1, 0xFFE0E080, 0x0000C0F1, 0xC0C0C000, 0x000080F1, 0x80808000,
+  0xF0F1F1F1, 0xFFFFF0F0, 0xF0F1F1F1, 0xFFFFF8F8, 0xF1F1F1F1, 0xFFFFF1F1, 0xE1F1F1F1, 0xFFFFE3E3,
+  0xC1F1F1F1, 0xFFFFC1C1, 0x80E0F1F1, 0xFFE08080, 0x00C0C0F1, 0xC0C00000, 0x008080F1, 0x80800000,
+  0xE0E0F1F1, 0xFFF0F0E0, 0xE0E0F1F1, 0xFFF8F8E0, 0xE0E0F1F1, 0xFFF1F1E0, 0xE0E0F1F1, 0xFFE3E3E0,
+  0xC0C0F1F1, 0xFFC1C1C0, 0x8080F1F1, 0xFF808080, 0x0000C0F1, 0xC0000000, 0x000080F1, 0x80000000,
+  0xC0C0C0F1, 0xF0F0C0C0, 0xC0C0C0F1, 0xF8F8C0C0, 0xC0C0C0F1, 0xF1F1C0C0, 0xC0C0C0F1, 0xE3E3C0C0,
+  0xC0C0C0F1, 0xC1C1C0C0, 0x808080F1, 0x80808080, 0x000000F1, 0x00000000, 0x000000F1, 0x00000000,
+  0x808080F1, 0xF0808080, 0x808080F1, 0xF8808080, 0x808080F1, 0xF1808080, 0x808080F1, 0xE3808080,
+  0x808080F1, 0xC1808080, 0x808080F1, 0x80808080, 0x000000F1, 0x00000000, 0x000000F1, 0x00000000,
+  0xC0C0E0E0, 0xC0C0C0C0, 0xC0C0E0E0, 0xC0C0C0C0, 0xC0C0E0F1, 0xC0C0C0C0, 0xC1C1E3E3, 0xC1C1C1C1,
+  0x818183C7, 0x81818181, 0x81818383, 0x81818181, 0x01010303, 0x01010101, 0x00000023, 0x00000000,
+  0xC0C0E0E0, 0xFFC0C0C0, 0xE0E0E0E0, 0xFFE0E0E0, 0xE1E1F1F1, 0xFFE1E1E1, 0x00000000, 0x00000000,
+  0xC3C3C7C7, 0xFFC3C3C3, 0x83838383, 0xFF838383, 0x01010303, 0xFF010101, 0x00000023, 0x80000000,
+  0xC0C0E0E3, 0xFFC1C0C1, 0xE0E0E0E3, 0xFFFFE0E2, 0xF1F1F1FF, 0xFFFFF1F5, 0xE3E3E3FF, 0xFFFFE3EB,
+  0xC7C7C7FF, 0xFFFFC7D7, 0x838383E3, 0xFFFF83A3, 0x010103E3, 0xFFC10141, 0x000000E3, 0x80800080,
+  0xC0C0E3E3, 0xFFC1C1C0, 0xE0E0E3E3, 0xFFFFE3E0, 0xF1E1E3E3, 0xFFFFFFF1, 0xE3E3E3E3, 0xFFFFFFE3,
+  0xC7C3E3E3, 0xFFFFFFC7, 0x8383E3E3, 0xFFFFE383, 0x0101E3E3, 0xFFC1C101, 0x000080E3, 0x80808000,
+  0xC0C1E3E3, 0xFFC1C0C0, 0xE0E3E3E3, 0xFFFFE0E0, 0xE1E3E3E3, 0xFFFFF1F1, 0xE3E3E3E3, 0xFFFFE3E3,
+  0xC3E3E3E3, 0xFFFFC7C7, 0x83E3E3E3, 0xFFFF8383, 0x01C1E3E3, 0xFFC10101, 0x008080E3, 0x80800000,
+  0xC0C0E3E3, 0xFFC0C0C0, 0xC0C0E3E3, 0xFFE0E0C0, 0xC1C1E3E3, 0xFFF1F1C1, 0xC1C1E3E3, 0xFFE3E3C1,
+  0xC1C1E3E3, 0xFFC7C7C1, 0x8181E3E3, 0xFF838381, 0x0101E3E3, 0xFF010101, 0x000080E3, 0x80000000,
+  0x808080E3, 0xC0C08080, 0x808080E3, 0xE0E08080, 0x808080E3, 0xF1F18080, 0x808080E3, 0xE3E38080,
+  0x808080E3, 0xC7C78080, 0x808080E3, 0x83838080, 0x000000E3, 0x01010000, 0x000000E3, 0x00000000,
+  0x000000E3, 0xC0000000, 0x000000E3, 0xE0000000, 0x000000E3, 0xF1000000, 0x000000E3, 0xE3000000,
+  0x000000E3, 0xC7000000, 0x000000E3, 0x83000000, 0x000000E3, 0x01000000, 0x000000E3, 0x00000000,
+  0x808080FC, 0x80808080, 0x808080F8, 0x80808080, 0x808080F1, 0x80808080, 0x808080E3, 0x80808080,
+  0x808080C7, 0x80808080, 0x8080808F, 0x80808080, 0x8080001F, 0x80808080, 0x8080003F, 0x80808080,
+  0x8080F0FC, 0x80808080, 0x8080F8F8, 0x80808080, 0x8080F0F1, 0x80808080, 0x8080E0E3, 0x80808080,
+  0x8080C0C7, 0x80808080, 0x8080808F, 0x80808080, 0x8000001F, 0x80808080, 0x8000003F, 0x80808080,
+  0x00000000, 0x00000000, 0x80F8F8FF, 0x80808080, 0x80F0F0FF, 0x80808080, 0x80E0E0FF, 0x80808080,
+  0x80C0C0FF, 0x80808080, 0x808080FF, 0x80808080, 0x000000FF, 0x80808080, 0x000000FF, 0x80808080,
+  0xF0F0FFFF, 0xC0C0C0C0, 0xF8F8FFFF, 0xC0C0C0C0, 0xF0F0FCFF, 0xC0C0C0C0, 0xE0E0F8FF, 0xC0C0C0C0,
+  0xC0C0F0FF, 0xC0C0C0C0, 0x8080E0FF, 0x80808080, 0x0000C0FF, 0x80808000, 0x000080FF, 0x80808000,
+  0xF0F0FCFF, 0xE0E0E0F0, 0xF8FCFCFF, 0xE0E0E0F8, 0xF0F8F8FF, 0xE0E0E0F0, 0xE0F0F0FF, 0xE0E0E0E0,
+  0xC0E0E0FF, 0xC0C0C0C0, 0x80C0C0FF, 0x80808080, 0x008080FF, 0x80800000, 0x008080FF, 0x80800000,
+  0xF0F0F8FF, 0xF0F0F0F0, 0xF8F8F8FF, 0xF0F0F8F8, 0xF0F0F8FF, 0xF0F0F0F0, 0xE0E0F0FF, 0xE0E0E0E0,
+  0xC0C0E0FF, 0xC0C0C0C0, 0x8080C0FF, 0x80808080, 0x808080FF, 0x80000000, 0x808080FF, 0x80000000,
+  0xF0F0F0FF, 0xF0F0F0F0, 0xF0F0F0FF, 0xF8F8F0F0, 0xF0F0F0FF, 0xF0F0F0F0, 0xE0E0E0FF, 0xE0E0E0E0,
+  0xC0C0C0FF, 0xC0C0C0C0, 0x808080FF, 0x80808080, 0x808080FF, 0x00000080, 0x808080FF, 0x00000080,
+  0xE0E0E0FF, 0xF0E0E0E0, 0xE0E0E0FF, 0xF8E0E0E0, 0xE0E0E0FF, 0xF0E0E0E0, 0xE0E0E0FF, 0xE0E0E0E0,
+  0xC0C0C0FF, 0xC0C0C0C0, 0x808080FF, 0x80808080, 0x808080FF, 0x00008080, 0x808080FF, 0x00008080,
+  0xE0E0F0FC, 0xE0E0E0E0, 0xE0E0F0F8, 0xE0E0E0E0, 0xE0E0F0F1, 0xE0E0E0E0, 0xC0C0C0E3, 0xC0C0C0C0,
+  0xC0C0C0C7, 0xC0C0C0C0, 0x8080808F, 0x80808080, 0x0000001F, 0x00000000, 0x0000003F, 0x00000000,
+  0xF0F8FCFC, 0xF0F0F0F0, 0xF0F8F8F8, 0xF0F0F0F0, 0xE0E0F1F1, 0xE0E0E0E0, 0xE0E0E0E3, 0xE0E0E0E0,
+  0xC0C0C0C7, 0xC0C0C0C0, 0x8080808F, 0x80808080, 0x0000001F, 0x00000000, 0x0000003F, 0x00000000,
+  0xF8FCFCFF, 0xF8F8F8F8, 0x00000000, 0x00000000, 0xF0F1F1FF, 0xF0F0F0F0, 0xE0E0E0FF, 0xE0E0E0E0,
+  0xC0C0C0FF, 0xC0C0C0C0, 0x808080FF, 0x80808080, 0x000000FF, 0x00000000, 0x000000FF, 0x00000000,
+  0xFCFCFFFF, 0xFFFCFDFC, 0xF8F8FFFF, 0xFFF8FAF8, 0xF1F1FFFF, 0xFFF1F5F1, 0xE0E0F8FF, 0xFFE0E8E0,
+  0xC0C0F0FF, 0xF0C0D0C0, 0x8080E0FF, 0xE080A080, 0x0000C0FF, 0xC0004000, 0x000080FF, 0x80808000,
+  0xF8F8F8FF, 0xFFFFFCFC, 0xF8F8F8FF, 0xFFFFF8F8, 0xF0F8F8FF, 0xFFFFF1F1, 0xE0F0F0FF, 0xFFF8E0E0,
+  0xC0E0E0FF, 0xF0F0C0C0, 0x80C0C0FF, 0xE0E08080, 0x008080FF, 0xC0C00000, 0x000000FF, 0x80800000,
+  0xF0F0F0FF, 0xFFFCFCF8, 0xF0F0F0FF, 0xFFF8F8F8, 0xF0F0F0FF, 0xFFF1F1F0, 0xE0E0F0FF, 0xFFE0E0E0,
+  0xC0C0E0FF, 0xF0C0C0C0, 0x8080C0FF, 0xE0808080, 0x000080FF, 0xC0000000, 0x000000FF, 0x80000000,
+  0xE0E0E0FF, 0xFCFCF0E0, 0xE0E0E0FF, 0xF8F8F0E0, 0xE0E0E0FF, 0xF1F1F0E0, 0xE0E0E0FF, 0xE0E0E0E0,
+  0xC0C0C0FF, 0xC0C0C0C0, 0x808080FF, 0x80808080, 0x000000FF, 0x00000000, 0x000000FF, 0x00000000,
+  0xC0C0C0FF, 0xFCE0C0C0, 0xC0C0C0FF, 0xF8E0C0C0, 0xC0C0C0FF, 0xF1E0C0C0, 0xC0C0C0FF, 0xE0E0C0C0,
+  0xC0C0C0FF, 0xC0C0C0C0, 0x808080FF, 0x80808080, 0x000000FF, 0x00000000, 0x000000FF, 0x00000000,
+  0xC0C0E0FC, 0xC0C0C0C0, 0xC0C0E0F8, 0xC0C0C0C0, 0xC0C0E0F1, 0xC0C0C0C0, 0xC0C0E0E3, 0xC0C0C0C0,
+  0x808080C7, 0x80808080, 0x8080808F, 0x80808080, 0x0000001F, 0x00000000, 0x0000003F, 0x00000000,
+  0xE0F0F0FC, 0xE0E0E0E0, 0xE0F0F8F8, 0xE0E0E0E0, 0xE0F1F1F1, 0xE0E0E0E0, 0xC0C1E3E3, 0xC0C0C0C0,
+  0xC0C1C1C7, 0xC0C0C0C0, 0x8080808F, 0x80808080, 0x0000001F, 0x00000000, 0x0000003F, 0x00000000,
+  0xF0F0F0FF, 0xF0F0F0F0, 0xF0F8F8FF, 0xF0F0F0F0, 0x00000000, 0x00000000, 0xE1E3E3FF, 0xE1E1E1E1,
+  0xC1C1C1FF, 0xC1C1C1C1, 0x808080FF, 0x80808080, 0x000000FF, 0x00000000, 0x000000FF, 0x00000000,
+  0xF0F0F1FF, 0xFFF0F1F0, 0xF8F8FFFF, 0xFFF8FAF8, 0xF1F1FFFF, 0xFFF1F5F1, 0xE3E3FFFF, 0xFFE3EBE3,
+  0xC1C1F1FF, 0xFFC1D1C1, 0x8080E0FF, 0xE080A080, 0x0000C0FF, 0xC0004000, 0x000080FF, 0x80008000,
+  0xF0F0F0FF, 0xFFF1F0F0, 0xF0F1F1FF, 0xFFFFF8F8, 0xF1F1F1FF, 0xFFFFF1F1, 0xE1F1F1FF, 0xFFFFE3E3,
+  0xC1E1E1FF, 0xFFF1C1C1, 0x80C0C0FF, 0xE0E08080, 0x008080FF, 0xC0C00000, 0x000000FF, 0x80800000,
+  0xE0E0E0FF, 0xFFF0F0F0, 0xE0E0E0FF, 0xFFF8F8F0, 0xE0E0E0FF, 0xFFF1F1F1, 0xE0E0E0FF, 0xFFE3E3E1,
+  0xC0C0E0FF, 0xFFC1C1C1, 0x8080C0FF, 0xE0808080, 0x000080FF, 0xC0000000, 0x000000FF, 0x80000000,
+  0xC0C0C0FF, 0xF0F0E0C0, 0xC0C0C0FF, 0xF8F8E0C0, 0xC0C0C0FF, 0xF1F1E0C0, 0xC0C0C0FF, 0xE3E3E0C0,
+  0xC0C0C0FF, 0xC1C1C0C0, 0x808080FF, 0x80808080, 0x000000FF, 0x00000000, 0x000000FF, 0x00000000,
+  0x808080FF, 0xF0C08080, 0x808080FF, 0xF8C08080, 0x808080FF, 0xF1C08080, 0x808080FF, 0xE3C08080,
+  0x808080FF, 0xC1C08080, 0x808080FF, 0x80808080, 0x000000FF, 0x00000000, 0x000000FF, 0x00000000,
+  0x8080C0FC, 0x80808080, 0x8080C0F8, 0x80808080, 0x8080C1F1, 0x80808080, 0x8080C1E3, 0x80808080,
+  0x8080C1C7, 0x80808080, 0x0000018F, 0x00000000, 0x0000011F, 0x00000000, 0x0000003F, 0x00000000,
+  0xC0C0C0FC, 0xC0C0C0C0, 0xC0E0E0F8, 0xC0C0C0C0, 0xC0E0F1F1, 0xC0C0C0C0, 0xC1E3E3E3, 0xC1C1C1C1,
+  0x8183C7C7, 0x81818181, 0x8183838F, 0x81818181, 0x0101011F, 0x01010101, 0x0000003F, 0x00000000,
+  0xC0C0C0FF, 0xC0C0C0C0, 0xE0E0E0FF, 0xE0E0E0E0, 0xE1F1F1FF, 0xE1E1E1E1, 0x00000000, 0x00000000,
+  0xC3C7C7FF, 0xC3C3C3C3, 0x838383FF, 0x83838383, 0x010101FF, 0x01010101, 0x000000FF, 0x00000000,
+  0xC0C0C1FF, 0xC1C0C1C0, 0xE0E0E3FF, 0xFFE0E2E0, 0xF1F1FFFF, 0xFFF1F5F1, 0xE3E3FFFF, 0xFFE3EBE3,
+  0xC7C7FFFF, 0xFFC7D7C7, 0x8383E3FF, 0xFF83A383, 0x0101C1FF, 0xC1014101, 0x000080FF, 0x80008000,
+  0xC0C0C0FF, 0xC1C1C0C0, 0xE0E1E1FF, 0xFFE3E0E0, 0xE1E3E3FF, 0xFFFFF1F1, 0xE3E3E3FF, 0xFFFFE3E3,
+  0xC3E3E3FF, 0xFFFFC7C7, 0x83C3C3FF, 0xFFE38383, 0x018181FF, 0xC1C10101, 0x000000FF, 0x80800000,
+  0xC0C0C0FF, 0xC1C0C0C0, 0xC0C0C1FF, 0xFFE0E0E0, 0xC1C1C1FF, 0xFFF1F1E1, 0xC1C1C1FF, 0xFFE3E3E3,
+  0xC1C1C1FF, 0xFFC7C7C3, 0x8181C1FF, 0xFF838383, 0x010181FF, 0xC1010101, 0x000000FF, 0x80000000,
+  0x808080FF, 0xC0C0C080, 0x808080FF, 0xE0E0C080, 0x808080FF, 0xF1F1C180, 0x808080FF, 0xE3E3C180,
+  0x808080FF, 0xC7C7C180, 0x808080FF, 0x83838180, 0x000000FF, 0x01010100, 0x000000FF, 0x00000000,
+  0x000000FF, 0xC0800000, 0x000000FF, 0xE0800000, 0x000000FF, 0xF1800000, 0x000000FF, 0xE3800000,
+  0x000000FF, 0xC7800000, 0x000000FF, 0x83800000, 0x000000FF, 0x01000000, 0x000000FF, 0x00000000,
+  0xC0C0FCFC, 0xC0C0C0C0, 0xC0C0F8F8, 0xC0C0C0C0, 0xC0C0F1F1, 0xC0C0C0C0, 0xC0C0E3E3, 0xC0C0C0C0,
+  0xC0C0C7C7, 0xC0C0C0C0, 0xC0C08F8F, 0xC0C0C0C0, 0xC0C01F1F, 0xC0C0C0C0, 0xC0C03F3F, 0xC0C0C0C0,
+  0xC0C0FCFC, 0xC0C0C0C0, 0xC0C0F8F8, 0xC0C0C0C0, 0xC0C0F1F1, 0xC0C0C0C0, 0xC0C0E3E3, 0xC0C0C0C0,
+  0xC0C0C7C7, 0xC0C0C0C0, 0xC0808F8F, 0xC0C0C0C0, 0xC0001F1F, 0xC0C0C0C0, 0xC0003F3F, 0xC0C0C0C0,
+  0xC0F0FCFF, 0xC0C0C0C0, 0xC0F8F8FF, 0xC0C0C0C0, 0xC0F0F1FF, 0xC0C0C0C0, 0xC0E0E3FF, 0xC0C0C0C0,
+  0xC0C0C7FF, 0xC0C0C0C0, 0x80808FFF, 0xC0C0C0C0, 0x00001FFF, 0xC0C0C0C0, 0x00003FFF, 0xC0C0C0C0,
+  0x00000000, 0x00000000, 0xF8F8FFFF, 0xC0C0C0C0, 0xF0F0FFFF, 0xC0C0C0C0, 0xE0E0FFFF, 0xC0C0C0C0,
+  0xC0C0FFFF, 0xC0C0C0C0, 0x8080FFFF, 0xC0C0C080, 0x0000FFFF, 0xC0C0C000, 0x0000FFFF, 0xC0C0C000,
+  0xF0FFFFFF, 0xE0E0E0F0, 0xF8FFFFFF, 0xE0E0E0F8, 0xF0FCFFFF, 0xE0E0E0F0, 0xE0F8FFFF, 0xE0E0E0E0,
+  0xC0F0FFFF, 0xC0C0C0C0, 0x80E0FFFF, 0xC0C08080, 0x00C0FFFF, 0xC0C00000, 0x00C0FFFF, 0xC0C00000,
+  0xF0FCFFFF, 0xF0F0F0F0, 0xFCFCFFFF, 0xF0F0F8F8, 0xF8F8FFFF, 0xF0F0F0F0, 0xF0F0FFFF, 0xE0E0E0E0,
+  0xE0E0FFFF, 0xC0C0C0C0, 0xC0C0FFFF, 0xC0808080, 0xC0C0FFFF, 0xC0000000, 0xC0C0FFFF, 0xC0000000,
+  0xF0F8FFFF, 0xF0F0F0F0, 0xF8F8FFFF, 0xF8F8F8F8, 0xF0F8FFFF, 0xF0F0F0F0, 0xE0F0FFFF, 0xE0E0E0E0,
+  0xC0E0FFFF, 0xC0C0C0C0, 0xC0C0FFFF, 0x808080C0, 0xC0C0FFFF, 0x000000C0, 0xC0C0FFFF, 0x000000C0,
+  0xF0F0FFFF, 0xF0F0F0F0, 0xF0F0FFFF, 0xF8F0F0F0, 0xF0F0FFFF, 0xF0F0F0F0, 0xE0E0FFFF, 0xE0E0E0E0,
+  0xC0C0FFFF, 0xC0C0C0C0, 0xC0C0FFFF, 0x8080C0C0, 0xC0C0FFFF, 0x0000C0C0, 0xC0C0FFFF, 0x0000C0C0,
+  0xC0C0FCFC, 0xC0C0C0C0, 0xC0C0F8F8, 0xC0C0C0C0, 0xC0C0F1F1, 0xC0C0C0C0, 0xC0C0E3E3, 0xC0C0C0C0,
+  0x8080C7C7, 0x80808080, 0x80808F8F, 0x80808080, 0x80801F1F, 0x80808080, 0x80803F3F, 0x80808080,
+  0xE0F0FCFC, 0xE0E0E0E0, 0xE0F0F8F8, 0xE0E0E0E0, 0xE0F0F1F1, 0xE0E0E0E0, 0xC0C0E3E3, 0xC0C0C0C0,
+  0xC0C0C7C7, 0xC0C0C0C0, 0x80808F8F, 0x80808080, 0x80001F1F, 0x80808080, 0x80003F3F, 0x80808080,
+  0xF8FCFCFF, 0xF0F0F0F0, 0xF8F8F8FF, 0xF0F0F0F0, 0xE0F1F1FF, 0xE0E0E0E0, 0xE0E0E3FF, 0xE0E0E0E0,
+  0xC0C0C7FF, 0xC0C0C0C0, 0x80808FFF, 0x80808080, 0x00001FFF, 0x80808080, 0x00003FFF, 0x80808080,
+  0xFCFCFFFF, 0xF8F8F8F8, 0x00000000, 0x00000000, 0xF1F1FFFF, 0xF0F0F0F0, 0xE0E0FFFF, 0xE0E0E0E0,
+  0xC0C0FFFF, 0xC0C0C0C0, 0x8080FFFF, 0x80808080, 0x0000FFFF, 0x80808000, 0x0000FFFF, 0x80808000,
+  0xFCFFFFFF, 0xFCFDFCFC, 0xF8FFFFFF, 0xF8FAF8F8, 0xF1FFFFFF, 0xF1F5F1F1, 0xE0F8FFFF, 0xE0E8E0E0,
+  0xC0F0FFFF, 0xC0D0C0C0, 0x80E0FFFF, 0x80A08080, 0x00C0FFFF, 0xC0C00000, 0x0080FFFF, 0x80800000,
+  0xF8F8FFFF, 0xFFFCFCF8, 0xF8F8FFFF, 0xFFF8F8F8, 0xF8F8FFFF, 0xFFF1F1F0, 0xF0F0FFFF, 0xF8E0E0E0,
+  0xE0E0FFFF, 0xF0C0C0C0, 0xC0C0FFFF, 0xE0808080, 0x8080FFFF, 0xC0000000, 0x8080FFFF, 0x80000000,
+  0xF0F0FFFF, 0xFCFCF8F0, 0xF0F0FFFF, 0xF8F8F8F0, 0xF0F0FFFF, 0xF1F1F0F0, 0xE0F0FFFF, 0xE0E0E0E0,
+  0xC0E0FFFF, 0xC0C0C0C0, 0x80C0FFFF, 0x80808080, 0x8080FFFF, 0x00000080, 0x8080FFFF, 0x00000080,
+  0xE0E0FFFF, 0xFCF0E0E0, 0xE0E0FFFF, 0xF8F0E0E0, 0xE0E0FFFF, 0xF1F0E0E0, 0xE0E0FFFF, 0xE0E0E0E0,
+  0xC0C0FFFF, 0xC0C0C0C0, 0x8080FFFF, 0x80808080, 0x8080FFFF, 0x00008080, 0x8080FFFF, 0x00008080,
+  0x8080FCFC, 0x80808080, 0x8080F8F8, 0x80808080, 0x8080F1F1, 0x80808080, 0x8080E3E3, 0x80808080,
+  0x8080C7C7, 0x80808080, 0x00008F8F, 0x00000000, 0x00001F1F, 0x00000000, 0x00003F3F, 0x00000000,
+  0xC0E0FCFC, 0xC0C0C0C0, 0xC0E0F8F8, 0xC0C0C0C0, 0xC0E0F1F1, 0xC0C0C0C0, 0xC0E0E3E3, 0xC0C0C0C0,
+  0x8080C7C7, 0x80808080, 0x80808F8F, 0x80808080, 0x00001F1F, 0x00000000, 0x00003F3F, 0x00000000,
+  0xF0F0FCFF, 0xE0E0E0E0, 0xF0F8F8FF, 0xE0E0E0E0, 0xF1F1F1FF, 0xE0E0E0E0, 0xC1E3E3FF, 0xC0C0C0C0,
+  0xC1C1C7FF, 0xC0C0C0C0, 0x80808FFF, 0x80808080, 0x00001FFF, 0x00000000, 0x00003FFF, 0x00000000,
+  0xF0F0FFFF, 0xF0F0F0F0, 0xF8F8FFFF, 0xF0F0F0F0, 0x00000000, 0x00000000, 0xE3E3FFFF, 0xE1E1E1E1,
+  0xC1C1FFFF, 0xC1C1C1C1, 0x8080FFFF, 0x80808080, 0x0000FFFF, 0x00000000, 0x0000FFFF, 0x00000000,
+  0xF0F1FFFF, 0xF0F1F0F0, 0xF8FFFFFF, 0xF8FAF8F8, 0xF1FFFFFF, 0xF1F5F1F1, 0xE3FFFFFF, 0xE3EBE3E3,
+  0xC1F1FFFF, 0xC1D1C1C1, 0x80E0FFFF, 0x80A08080, 0x00C0FFFF, 0x00400000, 0x0080FFFF, 0x80800000,
+  0xF0F0FFFF, 0xF1F0F0F0, 0xF1F1FFFF, 0xFFF8F8F0, 0xF1F1FFFF, 0xFFF1F1F1, 0xF1F1FFFF, 0xFFE3E3E1,
+  0xE1E1FFFF, 0xF1C1C1C1, 0xC0C0FFFF, 0xE0808080, 0x8080FFFF, 0xC0000000, 0x0000FFFF, 0x80000000,
+  0xE0E0FFFF, 0xF0F0F0E0, 0xE0E0FFFF, 0xF8F8F0E0, 0xE0E0FFFF, 0xF1F1F1E0, 0xE0E0FFFF, 0xE3E3E1E0,
+  0xC0E0FFFF, 0xC1C1C1C0, 0x80C0FFFF, 0x80808080, 0x0080FFFF, 0x00000000, 0x0000FFFF, 0x00000000,
+  0xC0C0FFFF, 0xF0E0C0C0, 0xC0C0FFFF, 0xF8E0C0C0, 0xC0C0FFFF, 0xF1E0C0C0, 0xC0C0FFFF, 0xE3E0C0C0,
+  0xC0C0FFFF, 0xC1C0C0C0, 0x8080FFFF, 0x80808080, 0x0000FFFF, 0x00000000, 0x0000FFFF, 0x00000000,
+  0x0000FCFC, 0x00000000, 0x0000F8F8, 0x00000000, 0x0000F1F1, 0x00000000, 0x0000E3E3, 0x00000000,
+  0x0000C7C7, 0x00000000, 0x00008F8F, 0x00000000, 0x00001F1F, 0x00000000, 0x00003F3F, 0x00000000,
+  0x80C0FCFC, 0x80808080, 0x80C0F8F8, 0x80808080, 0x80C1F1F1, 0x80808080, 0x80C1E3E3, 0x80808080,
+  0x80C1C7C7, 0x80808080, 0x00018F8F, 0x00000000, 0x00011F1F, 0x00000000, 0x00003F3F, 0x00000000,
+  0xC0C0FCFF, 0xC0C0C0C0, 0xE0E0F8FF, 0xC0C0C0C0, 0xE0F1F1FF, 0xC0C0C0C0, 0xE3E3E3FF, 0xC1C1C1C1,
+  0x83C7C7FF, 0x81818181, 0x83838FFF, 0x81818181, 0x01011FFF, 0x01010101, 0x00003FFF, 0x00000000,
+  0xC0C0FFFF, 0xC0C0C0C0, 0xE0E0FFFF, 0xE0E0E0E0, 0xF1F1FFFF, 0xE1E1E1E1, 0x00000000, 0x00000000,
+  0xC7C7FFFF, 0xC3C3C3C3, 0x8383FFFF, 0x83838383, 0x0101FFFF, 0x01010101, 0x0000FFFF, 0x00000000,
+  0xC0C1FFFF, 0xC0C1C0C0, 0xE0E3FFFF, 0xE0E2E0E0, 0xF1FFFFFF, 0xF1F5F1F1, 0xE3FFFFFF, 0xE3EBE3E3,
+  0xC7FFFFFF, 0xC7D7C7C7, 0x83E3FFFF, 0x83A38383, 0x01C1FFFF, 0x01410101, 0x0080FFFF, 0x00800000,
+  0xC0C0FFFF, 0xC1C0C0C0, 0xE1E1FFFF, 0xE3E0E0E0, 0xE3E3FFFF, 0xFFF1F1E1, 0xE3E3FFFF, 0xFFE3E3E3,
+  0xE3E3FFFF, 0xFFC7C7C3, 0xC3C3FFFF, 0xE3838383, 0x8181FFFF, 0xC1010101, 0x0000FFFF, 0x80000000,
+  0xC0C0FFFF, 0xC0C0C0C0, 0xC0C1FFFF, 0xE0E0E0C0, 0xC1C1FFFF, 0xF1F1E1C1, 0xC1C1FFFF, 0xE3E3E3C1,
+  0xC1C1FFFF, 0xC7C7C3C1, 0x81C1FFFF, 0x83838381, 0x0181FFFF, 0x01010101, 0x0000FFFF, 0x00000000,
+  0x8080FFFF, 0xC0C08080, 0x8080FFFF, 0xE0C08080, 0x8080FFFF, 0xF1C18080, 0x8080FFFF, 0xE3C18080,
+  0x8080FFFF, 0xC7C18080, 0x8080FFFF, 0x83818080, 0x0000FFFF, 0x01010000, 0x0000FFFF, 0x00000000,
+  0xE0FFFCFC, 0xE0E0E0E0, 0xE0FFF8F8, 0xE0E0E0E0, 0xE0FFF1F1, 0xE0E0E0E0, 0xE0FFE3E3, 0xE0E0E0E0,
+  0xE0FFC7C7, 0xE0E0E0E0, 0xE0FF8F8F, 0xE0E0E0E0, 0xE0FF1F1F, 0xE0E0E0E0, 0xE0FF3F3F, 0xE0E0E0E0,
+  0xE0FCFCFC, 0xE0E0E0E0, 0xE0F8F8F8, 0xE0E0E0E0, 0xE0F1F1F1, 0xE0E0E0E0, 0xE0E3E3E3, 0xE0E0E0E0,
+  0xE0C7C7C7, 0xE0E0E0E0, 0xE08F8F8F, 0xE0E0E0E0, 0xE01F1F1F, 0xE0E0E0E0, 0xE03F3F3F, 0xE0E0E0E0,
+  0xE0FCFCFF, 0xE0E0E0E0, 0xE0F8F8FF, 0xE0E0E0E0, 0xE0F1F1FF, 0xE0E0E0E0, 0xE0E3E3FF, 0xE0E0E0E0,
+  0xC0C7C7FF, 0xE0E0E0E0, 0x808F8FFF, 0xE0E0E0E0, 0x001F1FFF, 0xE0E0E0E0, 0x203F3FFF, 0xE0E0E0E0,
+  0xF0FCFFFF, 0xE0E0E0E0, 0xF8F8FFFF, 0xE0E0E0E0, 0xF0F1FFFF, 0xE0E0E0E0, 0xE0E3FFFF, 0xE0E0E0E0,
+  0xC0C7FFFF, 0xE0E0E0C0, 0x808FFFFF, 0xE0E0E080, 0x001FFFFF, 0xE0E0E000, 0x203FFFFF, 0xE0E0E020,
+  0x00000000, 0x00000000, 0xF8FFFFFF, 0xE0E0E0F8, 0xF0FFFFFF, 0xE0E0E0F0, 0xE0FFFFFF, 0xE0E0E0E0,
+  0xC0FFFFFF, 0xE0E0C0C0, 0x80FFFFFF, 0xE0E08080, 0x00FFFFFF, 0xE0E00000, 0x20FFFFFF, 0xE0E02020,
+  0xFFFFFFFF, 0xF0F0F0F0, 0xFFFFFFFF, 0xF0F0F8F8, 0xFCFFFFFF, 0xF0F0F0F0, 0xF8FFFFFF, 0xE0E0E0E0,
+  0xF0FFFFFF, 0xE0C0C0C0, 0xE0FFFFFF, 0xE0808080, 0xE0FFFFFF, 0xE0000000, 0xE0FFFFFF, 0xE0202020,
+  0xFCFFFFFF, 0xF0F0F0F0, 0xFCFFFFFF, 0xF8F8F8FC, 0xF8FFFFFF, 0xF0F0F0F8, 0xF0FFFFFF, 0xE0E0E0F0,
+  0xE0FFFFFF, 0xC0C0C0E0, 0xE0FFFFFF, 0x808080E0, 0xE0FFFFFF, 0x000000E0, 0xE0FFFFFF, 0x202020E0,
+  0xF8FFFFFF, 0xF0F0F0F0, 0xF8FFFFFF, 0xF8F8F8F8, 0xF8FFFFFF, 0xF0F0F0F0, 0xF0FFFFFF, 0xE0E0E0E0,
+  0xE0FFFFFF, 0xC0C0E0E0, 0xE0FFFFFF, 0x8080E0E0, 0xE0FFFFFF, 0x0000E0E0, 0xE0FFFFFF, 0x2020E0E0,
+  0xC0FFFCFC, 0xC0C0C0C0, 0xC0FFF8F8, 0xC0C0C0C0, 0xC0FFF1F1, 0xC0C0C0C0, 0xC0FFE3E3, 0xC0C0C0C0,
+  0xC0FFC7C7, 0xC0C0C0C0, 0xC0FF8F8F, 0xC0C0C0C0, 0xC0FF1F1F, 0xC0C0C0C0, 0xC0FF3F3F, 0xC0C0C0C0,
+  0xC0FCFCFC, 0xC0C0C0C0, 0xC0F8F8F8, 0xC0C0C0C0, 0xC0F1F1F1, 0xC0C0C0C0, 0xC0E3E3E3, 0xC0C0C0C0,
+  0xC0C7C7C7, 0xC0C0C0C0, 0xC08F8F8F, 0xC0C0C0C0, 0xC01F1F1F, 0xC0C0C0C0, 0xC03F3F3F, 0xC0C0C0C0,
+  0xF0FCFCFF, 0xE0E0E0E0, 0xF0F8F8FF, 0xE0E0E0E0, 0xF0F1F1FF, 0xE0E0E0E0, 0xC0E3E3FF, 0xC0C0C0C0,
+  0xC0C7C7FF, 0xC0C0C0C0, 0x808F8FFF, 0xC0C0C0C0, 0x001F1FFF, 0xC0C0C0C0, 0x003F3FFF, 0xC0C0C0C0,
+  0xFCFCFFFF, 0xF0F0F0F8, 0xF8F8FFFF, 0xF0F0F0F8, 0xF1F1FFFF, 0xE0E0E0E0, 0xE0E3FFFF, 0xE0E0E0E0,
+  0xC0C7FFFF, 0xE0C0C0C0, 0x808FFFFF, 0xC0C0C080, 0x001FFFFF, 0xC0C0C000, 0x003FFFFF, 0xC0C0C000,
+  0xFCFFFFFF, 0xF8F8F8FC, 0x00000000, 0x00000000, 0xF1FFFFFF, 0xF0F0F0F1, 0xE0FFFFFF, 0xF0F0E0E0,
+  0xC0FFFFFF, 0xE0E0C0C0, 0x80FFFFFF, 0xC0C08080, 0x00FFFFFF, 0xC0C00000, 0x00FFFFFF, 0xC0C00000,
+  0xFFFFFFFF, 0xFFFCFCFC, 0xFFFFFFFF, 0xFFF8F8F8, 0xFFFFFFFF, 0xFFF1F1F1, 0xF8FFFFFF, 0xF8E0E0E0,
+  0xF0FFFFFF, 0xF0C0C0C0, 0xE0FFFFFF, 0xE0808080, 0xC0FFFFFF, 0xC0000000, 0xC0FFFFFF, 0xC0000000,
+  0xF8FFFFFF, 0xFCFCF8F8, 0xF8FFFFFF, 0xF8F8F8F8, 0xF8FFFFFF, 0xF1F1F0F8, 0xF0FFFFFF, 0xE0E0E0F0,
+  0xE0FFFFFF, 0xC0C0C0E0, 0xC0FFFFFF, 0x808080C0, 0xC0FFFFFF, 0x000000C0, 0xC0FFFFFF, 0x000000C0,
+  0xF0FFFFFF, 0xFCF8F0F0, 0xF0FFFFFF, 0xF8F8F0F0, 0xF0FFFFFF, 0xF1F0F0F0, 0xF0FFFFFF, 0xE0E0E0E0,
+  0xE0FFFFFF, 0xC0C0C0C0, 0xC0FFFFFF, 0x8080C0C0, 0xC0FFFFFF, 0x0000C0C0, 0xC0FFFFFF, 0x0000C0C0,
+  0x80FFFCFC, 0x80808080, 0x80FFF8F8, 0x80808080, 0x80FFF1F1, 0x80808080, 0x80FFE3E3, 0x80808080,
+  0x80FFC7C7, 0x80808080, 0x80FF8F8F, 0x80808080, 0x80FF1F1F, 0x80808080, 0x80FF3F3F, 0x80808080,
+  0x80FCFCFC, 0x80808080, 0x80F8F8F8, 0x80808080, 0x80F1F1F1, 0x80808080, 0x80E3E3E3, 0x80808080,
+  0x80C7C7C7, 0x80808080, 0x808F8F8F, 0x80808080, 0x801F1F1F, 0x80808080, 0x803F3F3F, 0x80808080,
+  0xE0FCFCFF, 0xC0C0C0C0, 0xE0F8F8FF, 0xC0C0C0C0, 0xE0F1F1FF, 0xC0C0C0C0, 0xE0E3E3FF, 0xC0C0C0C0,
+  0x80C7C7FF, 0x80808080, 0x808F8FFF, 0x80808080, 0x001F1FFF, 0x80808080, 0x003F3FFF, 0x80808080,
+  0xF0FCFFFF, 0xE0E0E0F0, 0xF8F8FFFF, 0xE0E0E0F0, 0xF1F1FFFF, 0xE0E0E0F1, 0xE3E3FFFF, 0xC0C0C0C1,
+  0xC1C7FFFF, 0xC0C0C0C1, 0x808FFFFF, 0xC0808080, 0x001FFFFF, 0x80808000, 0x003FFFFF, 0x80808000,
+  0xF0FFFFFF, 0xF0F0F0F0, 0xF8FFFFFF, 0xF0F0F0F8, 0x00000000, 0x00000000, 0xE3FFFFFF, 0xE1E1E1E3,
+  0xC1FFFFFF, 0xE1E1C1C1, 0x80FFFFFF, 0xC0C08080, 0x00FFFFFF, 0x80800000, 0x00FFFFFF, 0x80800000,
+  0xF1FFFFFF, 0xF1F0F0F0, 0xFFFFFFFF, 0xFFF8F8F8, 0xFFFFFFFF, 0xFFF1F1F1, 0xFFFFFFFF, 0xFFE3E3E3,
+  0xF1FFFFFF, 0xF1C1C1C1, 0xE0FFFFFF, 0xE0808080, 0xC0FFFFFF, 0xC0000000, 0x80FFFFFF, 0x80000000,
+  0xF0FFFFFF, 0xF0F0F0F0, 0xF1FFFFFF, 0xF8F8F0F1, 0xF1FFFFFF, 0xF1F1F1F1, 0xF1FFFFFF, 0xE3E3E1F1,
+  0xE1FFFFFF, 0xC1C1C1E1, 0xC0FFFFFF, 0x808080C0, 0x80FFFFFF, 0x00000080, 0x80FFFFFF, 0x00000080,
+  0xE0FFFFFF, 0xF0F0E0E0, 0xE0FFFFFF, 0xF8F0E0E0, 0xE0FFFFFF, 0xF1F1E0E0, 0xE0FFFFFF, 0xE3E1E0E0,
+  0xE0FFFFFF, 0xC1C1C0C0, 0xC0FFFFFF, 0x80808080, 0x80FFFFFF, 0x00008080, 0x80FFFFFF, 0x00008080,
+  0x00FFFCFC, 0x00000000, 0x00FFF8F8, 0x00000000, 0x00FFF1F1, 0x00000000, 0x00FFE3E3, 0x00000000,
+  0x00FFC7C7, 0x00000000, 0x00FF8F8F, 0x00000000, 0x00FF1F1F, 0x00000000, 0x00FF3F3F, 0x00000000,
+  0x00FCFCFC, 0x00000000, 0x00F8F8F8, 0x00000000, 0x00F1F1F1, 0x00000000, 0x00E3E3E3, 0x00000000,
+  0x00C7C7C7, 0x00000000, 0x008F8F8F, 0x00000000, 0x001F1F1F, 0x00000000, 0x003F3F3F, 0x00000000,
+  0xC0FCFCFF, 0x80808080, 0xC0F8F8FF, 0x80808080, 0xC1F1F1FF, 0x80808080, 0xC1E3E3FF, 0x80808080,
+  0xC1C7C7FF, 0x80808080, 0x018F8FFF, 0x00000000, 0x011F1FFF, 0x00000000, 0x003F3FFF, 0x00000000,
+  0xC0FCFFFF, 0xC0C0C0C0, 0xE0F8FFFF, 0xC0C0C0E0, 0xF1F1FFFF, 0xC0C0C0E0, 0xE3E3FFFF, 0xC1C1C1E3,
+  0xC7C7FFFF, 0x81818183, 0x838FFFFF, 0x81818183, 0x011FFFFF, 0x81010101, 0x003FFFFF, 0x00000000,
+  0xC0FFFFFF, 0xC0C0C0C0, 0xE0FFFFFF, 0xE1E1E0E0, 0xF1FFFFFF, 0xE1E1E1F1, 0x00000000, 0x00000000,
+  0xC7FFFFFF, 0xC3C3C3C7, 0x83FFFFFF, 0xC3C38383, 0x01FFFFFF, 0x81810101, 0x00FFFFFF, 0x00000000,
+  0xC1FFFFFF, 0xC1C0C0C0, 0xE3FFFFFF, 0xE3E0E0E0, 0xFFFFFFFF, 0xFFF1F1F1, 0xFFFFFFFF, 0xFFE3E3E3,
+  0xFFFFFFFF, 0xFFC7C7C7, 0xE3FFFFFF, 0xE3838383, 0xC1FFFFFF, 0xC1010101, 0x80FFFFFF, 0x80000000,
+  0xC0FFFFFF, 0xC0C0C0C0, 0xE1FFFFFF, 0xE0E0E0E1, 0xE3FFFFFF, 0xF1F1E1E3, 0xE3FFFFFF, 0xE3E3E3E3,
+  0xE3FFFFFF, 0xC7C7C3E3, 0xC3FFFFFF, 0x838383C3, 0x81FFFFFF, 0x01010181, 0x00FFFFFF, 0x00000000,
+  0xC0FFFFFF, 0xC0C0C0C0, 0xC1FFFFFF, 0xE0E0C0C0, 0xC1FFFFFF, 0xF1E1C1C1, 0xC1FFFFFF, 0xE3E3C1C1,
+  0xC1FFFFFF, 0xC7C3C1C1, 0xC1FFFFFF, 0x83838181, 0x81FFFFFF, 0x01010101, 0x00FFFFFF, 0x00000000,
+  0xFFFFFCFC, 0xF0F0F0F0, 0xFFFFF8F8, 0xF0F0F0F0, 0xFFFFF1F1, 0xF0F0F0F0, 0xFFFFE3E3, 0xF0F0F0F0,
+  0xFFFFC7C7, 0xF0F0F0F0, 0xFFFF8F8F, 0xF0F0F0F0, 0xFFFF1F1F, 0xF0F0F0F0, 0xFFFF3F3F, 0xF0F0F0F0,
+  0xFFFCFCFC, 0xF0F0F0F0, 0xFFF8F8F8, 0xF0F0F0F0, 0xFFF1F1F1, 0xF0F0F0F0, 0xFFE3E3E3, 0xF0F0F0F0,
+  0xFFC7C7C7, 0xF0F0F0F0, 0xFF8F8F8F, 0xF0F0F0F0, 0xFF1F1F1F, 0xF0F0F0F0, 0xFF3F3F3F, 0xF0F0F0F0,
+  0xFCFCFCFF, 0xF0F0F0F0, 0xF8F8F8FF, 0xF0F0F0F0, 0xF1F1F1FF, 0xF0F0F0F0, 0xE3E3E3FF, 0xF0F0F0F0,
+  0xC7C7C7FF, 0xF0F0F0F0, 0x8F8F8FFF, 0xF0F0F0F0, 0x1F1F1FFF, 0xF0F0F0F0, 0x3F3F3FFF, 0xF0F0F0F0,
+  0xFCFCFFFF, 0xF0F0F0F0, 0xF8F8FFFF, 0xF0F0F0F0, 0xF1F1FFFF, 0xF0F0F0F0, 0xE3E3FFFF, 0xF0F0F0E0,
+  0xC7C7FFFF, 0xF0F0F0C0, 0x8F8FFFFF, 0xF0F0F080, 0x1F1FFFFF, 0xF0F0F010, 0x3F3FFFFF, 0xF0F0F030,
+  0xFCFFFFFF, 0xF0F0F0F0, 0xF8FFFFFF, 0xF0F0F0F8, 0xF1FFFFFF, 0xF0F0F0F0, 0xE3FFFFFF, 0xF0F0E0E0,
+  0xC7FFFFFF, 0xF0F0C0C0, 0x8FFFFFFF, 0xF0F08080, 0x1FFFFFFF, 0xF0F01010, 0x3FFFFFFF, 0xF0F03030,
+  0x00000000, 0x00000000, 0xFFFFFFFF, 0xF8F8F8F8, 0xFFFFFFFF, 0xF8F0F0F0, 0xFFFFFFFF, 0xF0E0E0E0,
+  0xFFFFFFFF, 0xF0C0C0C0, 0xFFFFFFFF, 0xF0808080, 0xFFFFFFFF, 0xF0101010, 0xFFFFFFFF, 0xF0303030,
+  0xFFFFFFFF, 0xF0F0F0FF, 0xFFFFFFFF, 0xF8F8F8FF, 0xFFFFFFFF, 0xF0F0F0FC, 0xFFFFFFFF, 0xE0E0E0F8,
+  0xFFFFFFFF, 0xC0C0C0F0, 0xFFFFFFFF, 0x808080F0, 0xFFFFFFFF, 0x101010F0, 0xFFFFFFFF, 0x303030F0,
+  0xFFFFFFFF, 0xF0F0F0F8, 0xFFFFFFFF, 0xF8F8FCFC, 0xFFFFFFFF, 0xF0F0F8F8, 0xFFFFFFFF, 0xE0E0F0F0,
+  0xFFFFFFFF, 0xC0C0F0F0, 0xFFFFFFFF, 0x8080F0F0, 0xFFFFFFFF, 0x1010F0F0, 0xFFFFFFFF, 0x3030F0F0,
+  0xFFFFFCFC, 0xE0E0E0E0, 0xFFFFF8F8, 0xE0E0E0E0, 0xFFFFF1F1, 0xE0E0E0E0, 0xFFFFE3E3, 0xE0E0E0E0,
+  0xFFFFC7C7, 0xE0E0E0E0, 0xFFFF8F8F, 0xE0E0E0E0, 0xFFFF1F1F, 0xE0E0E0E0, 0xFFFF3F3F, 0xE0E0E0E0,
+  0xFFFCFCFC, 0xE0E0E0E0, 0xFFF8F8F8, 0xE0E0E0E0, 0xFFF1F1F1, 0xE0E0E0E0, 0xFFE3E3E3, 0xE0E0E0E0,
+  0xFFC7C7C7, 0xE0E0E0E0, 0xFF8F8F8F, 0xE0E0E0E0, 0xFF1F1F1F, 0xE0E0E0E0, 0xFF3F3F3F, 0xE0E0E0E0,
+  0xFCFCFCFF, 0xE0E0E0E0, 0xF8F8F8FF, 0xE0E0E0E0, 0xF1F1F1FF, 0xE0E0E0E0, 0xE3E3E3FF, 0xE0E0E0E0,
+  0xC7C7C7FF, 0xE0E0E0E0, 0x8F8F8FFF, 0xE0E0E0E0, 0x1F1F1FFF, 0xE0E0E0E0, 0x3F3F3FFF, 0xE0E0E0E0,
+  0xFCFCFFFF, 0xF0F0F0F0, 0xF8F8FFFF, 0xF0F0F0F0, 0xF1F1FFFF, 0xF0F0F0F0, 0xE3E3FFFF, 0xF0E0E0E0,
+  0xC7C7FFFF, 0xF0E0E0C0, 0x8F8FFFFF, 0xE0E0E080, 0x1F1FFFFF, 0xE0E0E000, 0x3F3FFFFF, 0xE0E0E020,
+  0xFCFFFFFF, 0xF8F8F8FC, 0xF8FFFFFF, 0xF8F8F8F8, 0xF1FFFFFF, 0xF8F8F0F1, 0xE3FFFFFF, 0xF8F8E0E0,
+  0xC7FFFFFF, 0xF0F0C0C0, 0x8FFFFFFF, 0xE0E08080, 0x1FFFFFFF, 0xE0E00000, 0x3FFFFFFF, 0xE0E02020,
+  0xFFFFFFFF, 0xFDFCFCFC, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xF5F0F1F1, 0xFFFFFFFF, 0xF8E0E0E0,
+  0xFFFFFFFF, 0xF0C0C0C0, 0xFFFFFFFF, 0xE0808080, 0xFFFFFFFF, 0xE0000000, 0xFFFFFFFF, 0xE0202020,
+  0xFFFFFFFF, 0xFCFCFCFF, 0xFFFFFFFF, 0xF8F8F8FF, 0xFFFFFFFF, 0xF0F1F1FF, 0xFFFFFFFF, 0xE0E0E0F8,
+  0xFFFFFFFF, 0xC0C0C0F0, 0xFFFFFFFF, 0x808080E0, 0xFFFFFFFF, 0x000000E0, 0xFFFFFFFF, 0x202020E0,
+  0xFFFFFFFF, 0xFCF8F8F8, 0xFFFFFFFF, 0xF8F8F8F8, 0xFFFFFFFF, 0xF0F0F8F8, 0xFFFFFFFF, 0xE0E0F0F0,
+  0xFFFFFFFF, 0xC0C0E0E0, 0xFFFFFFFF, 0x8080E0E0, 0xFFFFFFFF, 0x0000E0E0, 0xFFFFFFFF, 0x2020E0E0,
+  0xFFFFFCFC, 0xC0C0C0C0, 0xFFFFF8F8, 0xC0C0C0C0, 0xFFFFF1F1, 0xC0C0C0C0, 0xFFFFE3E3, 0xC0C0C0C0,
+  0xFFFFC7C7, 0xC0C0C0C0, 0xFFFF8F8F, 0xC0C0C0C0, 0xFFFF1F1F, 0xC0C0C0C0, 0xFFFF3F3F, 0xC0C0C0C0,
+  0xFFFCFCFC, 0xC0C0C0C0, 0xFFF8F8F8, 0xC0C0C0C0, 0xFFF1F1F1, 0xC0C0C0C0, 0xFFE3E3E3, 0xC0C0C0C0,
+  0xFFC7C7C7, 0xC0C0C0C0, 0xFF8F8F8F, 0xC0C0C0C0, 0xFF1F1F1F, 0xC0C0C0C0, 0xFF3F3F3F, 0xC0C0C0C0,
+  0xFCFCFCFF, 0xC0C0C0C0, 0xF8F8F8FF, 0xC0C0C0C0, 0xF1F1F1FF, 0xC0C0C0C0, 0xE3E3E3FF, 0xC0C0C0C0,
+  0xC7C7C7FF, 0xC0C0C0C0, 0x8F8F8FFF, 0xC0C0C0C0, 0x1F1F1FFF, 0xC0C0C0C0, 0x3F3F3FFF, 0xC0C0C0C0,
+  0xFCFCFFFF, 0xE0E0E0E0, 0xF8F8FFFF, 0xE0E0E0E0, 0xF1F1FFFF, 0xE0E0E0E0, 0xE3E3FFFF, 0xE0E0E0E0,
+  0xC7C7FFFF, 0xE0C0C0C0, 0x8F8FFFFF, 0xE0C0C080, 0x1F1FFFFF, 0xC0C0C000, 0x3F3FFFFF, 0xC0C0C000,
+  0xFCFFFFFF, 0xF1F1F0F0, 0xF8FFFFFF, 0xF1F1F0F8, 0xF1FFFFFF, 0xF1F1F1F1, 0xE3FFFFFF, 0xF1F1E1E3,
+  0xC7FFFFFF, 0xF1F1C1C1, 0x8FFFFFFF, 0xE0E08080, 0x1FFFFFFF, 0xC0C00000, 0x3FFFFFFF, 0xC0C00000,
+  0xFFFFFFFF, 0xF1F0F0F0, 0xFFFFFFFF, 0xFAF8F8F8, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xEBE3E3E3,
+  0xFFFFFFFF, 0xF1C1C1C1, 0xFFFFFFFF, 0xE0808080, 0xFFFFFFFF, 0xC0000000, 0xFFFFFFFF, 0xC0000000,
+  0xFFFFFFFF, 0xF0F0F0F1, 0xFFFFFFFF, 0xF8F8F8FF, 0xFFFFFFFF, 0xF1F1F1FF, 0xFFFFFFFF, 0xE3E3E3FF,
+  0xFFFFFFFF, 0xC1C1C1F1, 0xFFFFFFFF, 0x808080E0, 0xFFFFFFFF, 0x000000C0, 0xFFFFFFFF, 0x000000C0,
+  0xFFFFFFFF, 0xF0F0F0F0, 0xFFFFFFFF, 0xF8F0F1F1, 0xFFFFFFFF, 0xF1F1F1F1, 0xFFFFFFFF, 0xE3E1F1F1,
+  0xFFFFFFFF, 0xC1C1E1E1, 0xFFFFFFFF, 0x8080C0C0, 0xFFFFFFFF, 0x0000C0C0, 0xFFFFFFFF, 0x0000C0C0,
+  0xFFFFFCFC, 0x80808080, 0xFFFFF8F8, 0x80808080, 0xFFFFF1F1, 0x80808080, 0xFFFFE3E3, 0x80808080,
+  0xFFFFC7C7, 0x80808080, 0xFFFF8F8F, 0x80808080, 0xFFFF1F1F, 0x80808080, 0xFFFF3F3F, 0x80808080,
+  0xFFFCFCFC, 0x80808080, 0xFFF8F8F8, 0x80808080, 0xFFF1F1F1, 0x80808080, 0xFFE3E3E3, 0x80808080,
+  0xFFC7C7C7, 0x80808080, 0xFF8F8F8F, 0x80808080, 0xFF1F1F1F, 0x80808080, 0xFF3F3F3F, 0x80808080,
+  0xFCFCFCFF, 0x80808080, 0xF8F8F8FF, 0x80808080, 0xF1F1F1FF, 0x80808080, 0xE3E3E3FF, 0x80808080,
+  0xC7C7C7FF, 0x80808080, 0x8F8F8FFF, 0x80808080, 0x1F1F1FFF, 0x80808080, 0x3F3F3FFF, 0x80808080,
+  0xFCFCFFFF, 0xC1C0C0C0, 0xF8F8FFFF, 0xC1C0C0C0, 0xF1F1FFFF, 0xC1C1C1C1, 0xE3E3FFFF, 0xC1C1C1C1,
+  0xC7C7FFFF, 0xC1C1C1C1, 0x8F8FFFFF, 0xC1818181, 0x1F1FFFFF, 0xC1818101, 0x3F3FFFFF, 0x80808000,
+  0xFCFFFFFF, 0xC1C1C0C0, 0xF8FFFFFF, 0xE3E3E0E0, 0xF1FFFFFF, 0xE3E3E1F1, 0xE3FFFFFF, 0xE3E3E3E3,
+  0xC7FFFFFF, 0xE3E3C3C7, 0x8FFFFFFF, 0xE3E38383, 0x1FFFFFFF, 0xC1C10101, 0x3FFFFFFF, 0x80800000,
+  0xFFFFFFFF, 0xC1C0C0C0, 0xFFFFFFFF, 0xE3E0E0E0, 0xFFFFFFFF, 0xF5F1F1F1, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xD7C7C7C7, 0xFFFFFFFF, 0xE3838383, 0xFFFFFFFF, 0xC1010101, 0xFFFFFFFF, 0x80000000,
+  0xFFFFFFFF, 0xC0C0C0C1, 0xFFFFFFFF, 0xE0E0E0E3, 0xFFFFFFFF, 0xF1F1F1FF, 0xFFFFFFFF, 0xE3E3E3FF,
+  0xFFFFFFFF, 0xC7C7C7FF, 0xFFFFFFFF, 0x838383E3, 0xFFFFFFFF, 0x010101C1, 0xFFFFFFFF, 0x00000080,
+  0xFFFFFFFF, 0xC0C0C0C0, 0xFFFFFFFF, 0xE0E0E1E1, 0xFFFFFFFF, 0xF1E1E3E3, 0xFFFFFFFF, 0xE3E3E3E3,
+  0xFFFFFFFF, 0xC7C3E3E3, 0xFFFFFFFF, 0x8383C3C3, 0xFFFFFFFF, 0x01018181, 0xFFFFFFFF, 0x00008080,
+  0xFFFFFCFC, 0xF8F8F8FF, 0xFFFFF8F8, 0xF8F8F8FF, 0xFFFFF1F1, 0xF8F8F8FF, 0xFFFFE3E3, 0xF8F8F8FF,
+  0xFFFFC7C7, 0xF8F8F8FF, 0xFFFF8F8F, 0xF8F8F8FF, 0xFFFF1F1F, 0xF8F8F8FF, 0xFFFF3F3F, 0xF8F8F8FF,
+  0xFFFCFCFC, 0xF8F8F8FF, 0xFFF8F8F8, 0xF8F8F8FF, 0xFFF1F1F1, 0xF8F8F8FF, 0xFFE3E3E3, 0xF8F8F8FF,
+  0xFFC7C7C7, 0xF8F8F8FF, 0xFF8F8F8F, 0xF8F8F8FF, 0xFF1F1F1F, 0xF8F8F8FF, 0xFF3F3F3F, 0xF8F8F8FF,
+  0xFCFCFCFF, 0xF8F8F8FF, 0xF8F8F8FF, 0xF8F8F8FF, 0xF1F1F1FF, 0xF8F8F8FF, 0xE3E3E3FF, 0xF8F8F8FF,
+  0xC7C7C7FF, 0xF8F8F8FF, 0x8F8F8FFF, 0xF8F8F8FF, 0x1F1F1FFF, 0xF8F8F8FF, 0x3F3F3FFF, 0xF8F8F8FF,
+  0xFCFCFFFF, 0xF8F8F8FC, 0xF8F8FFFF, 0xF8F8F8F8, 0xF1F1FFFF, 0xF8F8F8F1, 0xE3E3FFFF, 0xF8F8F8E3,
+  0xC7C7FFFF, 0xF8F8F8C7, 0x8F8FFFFF, 0xF8F8F88F, 0x1F1FFFFF, 0xF8F8F81F, 0x3F3FFFFF, 0xF8F8F83F,
+  0xFCFFFFFF, 0xF8F8F8FC, 0xF8FFFFFF, 0xF8F8F8F8, 0xF1FFFFFF, 0xF8F8F0F1, 0xE3FFFFFF, 0xF8F8E0E3,
+  0xC7FFFFFF, 0xF8F8C0C7, 0x8FFFFFFF, 0xF8F8888F, 0x1FFFFFFF, 0xF8F8181F, 0x3FFFFFFF, 0xF8F8383F,
+  0xFFFFFFFF, 0xFCFCFCFC, 0xFFFFFFFF, 0xFCF8F8F8, 0xFFFFFFFF, 0xFCF0F0F1, 0xFFFFFFFF, 0xF8E0E0E3,
+  0xFFFFFFFF, 0xF8C0C0C7, 0xFFFFFFFF, 0xF888888F, 0xFFFFFFFF, 0xF818181F, 0xFFFFFFFF, 0xF838383F,
+  0x00000000, 0x00000000, 0xFFFFFFFF, 0xF8F8F8FF, 0xFFFFFFFF, 0xF0F0F0FF, 0xFFFFFFFF, 0xE0E0E0FF,
+  0xFFFFFFFF, 0xC0C0C0FF, 0xFFFFFFFF, 0x888888FF, 0xFFFFFFFF, 0x181818FF, 0xFFFFFFFF, 0x383838FF,
+  0xFFFFFFFF, 0xF0F0F1FF, 0xFFFFFFFF, 0xF8F8FFFF, 0xFFFFFFFF, 0xF0F0FCFF, 0xFFFFFFFF, 0xE0E0F8FF,
+  0xFFFFFFFF, 0xC0C0F8FF, 0xFFFFFFFF, 0x8888F8FF, 0xFFFFFFFF, 0x1818F8FF, 0xFFFFFFFF, 0x3838F8FF,
+  0xFFFFFCFC, 0xF0F0F0FF, 0xFFFFF8F8, 0xF0F0F0FF, 0xFFFFF1F1, 0xF0F0F0FF, 0xFFFFE3E3, 0xF0F0F0FF,
+  0xFFFFC7C7, 0xF0F0F0FF, 0xFFFF8F8F, 0xF0F0F0FF, 0xFFFF1F1F, 0xF0F0F0FF, 0xFFFF3F3F, 0xF0F0F0FF,
+  0xFFFCFCFC, 0xF0F0F0FF, 0xFFF8F8F8, 0xF0F0F0FF, 0xFFF1F1F1, 0xF0F0F0FF, 0xFFE3E3E3, 0xF0F0F0FF,
+  0xFFC7C7C7, 0xF0F0F0FF, 0xFF8F8F8F, 0xF0F0F0FF, 0xFF1F1F1F, 0xF0F0F0FF, 0xFF3F3F3F, 0xF0F0F0FF,
+  0xFCFCFCFF, 0xF0F0F0FF, 0xF8F8F8FF, 0xF0F0F0FF, 0xF1F1F1FF, 0xF0F0F0FF, 0xE3E3E3FF, 0xF0F0F0FF,
+  0xC7C7C7FF, 0xF0F0F0FF, 0x8F8F8FFF, 0xF0F0F0FF, 0x1F1F1FFF, 0xF0F0F0FF, 0x3F3F3FFF, 0xF0F0F0FF,
+  0xFCFCFFFF, 0xF0F0F0FC, 0xF8F8FFFF, 0xF0F0F0F8, 0xF1F1FFFF, 0xF0F0F0F1, 0xE3E3FFFF, 0xF0F0F0E3,
+  0xC7C7FFFF, 0xF0F0F0C7, 0x8F8FFFFF, 0xF0F0F08F, 0x1F1FFFFF, 0xF0F0F01F, 0x3F3FFFFF, 0xF0F0F03F,
+  0xFCFFFFFF, 0xF0F0F0FC, 0xF8FFFFFF, 0xF0F0F0F8, 0xF1FFFFFF, 0xF0F0F0F1, 0xE3FFFFFF, 0xF0F0E0E3,
+  0xC7FFFFFF, 0xF0F0C0C7, 0x8FFFFFFF, 0xF0F0808F, 0x1FFFFFFF, 0xF0F0101F, 0x3FFFFFFF, 0xF0F0303F,
+  0xFFFFFFFF, 0xFAF8FCFC, 0xFFFFFFFF, 0xFDF8F8F8, 0xFFFFFFFF, 0xFAF0F1F1, 0xFFFFFFFF, 0xF8E0E0E3,
+  0xFFFFFFFF, 0xF0C0C0C7, 0xFFFFFFFF, 0xF080808F, 0xFFFFFFFF, 0xF010101F, 0xFFFFFFFF, 0xF030303F,
+  0xFFFFFFFF, 0xFCFCFCFF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xF1F1F1FF, 0xFFFFFFFF, 0xE0E0E0FF,
+  0xFFFFFFFF, 0xC0C0C0FF, 0xFFFFFFFF, 0x808080FF, 0xFFFFFFFF, 0x101010FF, 0xFFFFFFFF, 0x303030FF,
+  0xFFFFFFFF, 0xFCFCFFFF, 0xFFFFFFFF, 0xF8F8FFFF, 0xFFFFFFFF, 0xF1F1FFFF, 0xFFFFFFFF, 0xE0E0F8FF,
+  0xFFFFFFFF, 0xC0C0F0FF, 0xFFFFFFFF, 0x8080F0FF, 0xFFFFFFFF, 0x1010F0FF, 0xFFFFFFFF, 0x3030F0FF,
+  0xFFFFFCFC, 0xE0E0E0FF, 0xFFFFF8F8, 0xE0E0E0FF, 0xFFFFF1F1, 0xE0E0E0FF, 0xFFFFE3E3, 0xE0E0E0FF,
+  0xFFFFC7C7, 0xE0E0E0FF, 0xFFFF8F8F, 0xE0E0E0FF, 0xFFFF1F1F, 0xE0E0E0FF, 0xFFFF3F3F, 0xE0E0E0FF,
+  0xFFFCFCFC, 0xE0E0E0FF, 0xFFF8F8F8, 0xE0E0E0FF, 0xFFF1F1F1, 0xE0E0E0FF, 0xFFE3E3E3, 0xE0E0E0FF,
+  0xFFC7C7C7, 0xE0E0E0FF, 0xFF8F8F8F, 0xE0E0E0FF, 0xFF1F1F1F, 0xE0E0E0FF, 0xFF3F3F3F, 0xE0E0E0FF,
+  0xFCFCFCFF, 0xE0E0E0FF, 0xF8F8F8FF, 0xE0E0E0FF, 0xF1F1F1FF, 0xE0E0E0FF, 0xE3E3E3FF, 0xE0E0E0FF,
+  0xC7C7C7FF, 0xE0E0E0FF, 0x8F8F8FFF, 0xE0E0E0FF, 0x1F1F1FFF, 0xE0E0E0FF, 0x3F3F3FFF, 0xE0E0E0FF,
+  0xFCFCFFFF, 0xE0E0E0FC, 0xF8F8FFFF, 0xE0E0E0F8, 0xF1F1FFFF, 0xE0E0E0F1, 0xE3E3FFFF, 0xE0E0E0E3,
+  0xC7C7FFFF, 0xE0E0E0C7, 0x8F8FFFFF, 0xE0E0E08F, 0x1F1FFFFF, 0xE0E0E01F, 0x3F3FFFFF, 0xE0E0E03F,
+  0xFCFFFFFF, 0xE0E0E0FC, 0xF8FFFFFF, 0xE0E0E0F8, 0xF1FFFFFF, 0xE0E0E0F1, 0xE3FFFFFF, 0xE0E0E0E3,
+  0xC7FFFFFF, 0xE0E0C0C7, 0x8FFFFFFF, 0xE0E0808F, 0x1FFFFFFF, 0xE0E0001F, 0x3FFFFFFF, 0xE0E0203F,
+  0xFFFFFFFF, 0xF0F0F0FC, 0xFFFFFFFF, 0xF4F0F8F8, 0xFFFFFFFF, 0xFBF1F1F1, 0xFFFFFFFF, 0xF5E1E3E3,
+  0xFFFFFFFF, 0xF1C1C1C7, 0xFFFFFFFF, 0xE080808F, 0xFFFFFFFF, 0xE000001F, 0xFFFFFFFF, 0xE020203F,
+  0xFFFFFFFF, 0xF0F0F0FF, 0xFFFFFFFF, 0xF8F8F8FF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xE3E3E3FF,
+  0xFFFFFFFF, 0xC1C1C1FF, 0xFFFFFFFF, 0x808080FF, 0xFFFFFFFF, 0x000000FF, 0xFFFFFFFF, 0x202020FF,
+  0xFFFFFFFF, 0xF0F0F1FF, 0xFFFFFFFF, 0xF8F8FFFF, 0xFFFFFFFF, 0xF1F1FFFF, 0xFFFFFFFF, 0xE3E3FFFF,
+  0xFFFFFFFF, 0xC1C1F1FF, 0xFFFFFFFF, 0x8080E0FF, 0xFFFFFFFF, 0x0000E0FF, 0xFFFFFFFF, 0x2020E0FF,
+  0xFFFFFCFC, 0xC1C1C1FF, 0xFFFFF8F8, 0xC1C1C1FF, 0xFFFFF1F1, 0xC1C1C1FF, 0xFFFFE3E3, 0xC1C1C1FF,
+  0xFFFFC7C7, 0xC1C1C1FF, 0xFFFF8F8F, 0xC1C1C1FF, 0xFFFF1F1F, 0xC1C1C1FF, 0xFFFF3F3F, 0xC1C1C1FF,
+  0xFFFCFCFC, 0xC1C1C1FF, 0xFFF8F8F8, 0xC1C1C1FF, 0xFFF1F1F1, 0xC1C1C1FF, 0xFFE3E3E3, 0xC1C1C1FF,
+  0xFFC7C7C7, 0xC1C1C1FF, 0xFF8F8F8F, 0xC1C1C1FF, 0xFF1F1F1F, 0xC1C1C1FF, 0xFF3F3F3F, 0xC1C1C1FF,
+  0xFCFCFCFF, 0xC1C1C1FF, 0xF8F8F8FF, 0xC1C1C1FF, 0xF1F1F1FF, 0xC1C1C1FF, 0xE3E3E3FF, 0xC1C1C1FF,
+  0xC7C7C7FF, 0xC1C1C1FF, 0x8F8F8FFF, 0xC1C1C1FF, 0x1F1F1FFF, 0xC1C1C1FF, 0x3F3F3FFF, 0xC1C1C1FF,
+  0xFCFCFFFF, 0xC1C1C1FC, 0xF8F8FFFF, 0xC1C1C1F8, 0xF1F1FFFF, 0xC1C1C1F1, 0xE3E3FFFF, 0xC1C1C1E3,
+  0xC7C7FFFF, 0xC1C1C1C7, 0x8F8FFFFF, 0xC1C1C18F, 0x1F1FFFFF, 0xC1C1C11F, 0x3F3FFFFF, 0xC1C1C13F,
+  0xFCFFFFFF, 0xC1C1C0FC, 0xF8FFFFFF, 0xC1C1C0F8, 0xF1FFFFFF, 0xC1C1C1F1, 0xE3FFFFFF, 0xC1C1C1E3,
+  0xC7FFFFFF, 0xC1C1C1C7, 0x8FFFFFFF, 0xC1C1818F, 0x1FFFFFFF, 0xC1C1011F, 0x3FFFFFFF, 0xC1C1013F,
+  0xFFFFFFFF, 0xC1C0C0FC, 0xFFFFFFFF, 0xE3E0E0F8, 0xFFFFFFFF, 0xEBE1F1F1, 0xFFFFFFFF, 0xF7E3E3E3,
+  0xFFFFFFFF, 0xEBC3C7C7, 0xFFFFFFFF, 0xE383838F, 0xFFFFFFFF, 0xC101011F, 0xFFFFFFFF, 0xC101013F,
+  0xFFFFFFFF, 0xC0C0C0FF, 0xFFFFFFFF, 0xE0E0E0FF, 0xFFFFFFFF, 0xF1F1F1FF, 0x00000000, 0x00000000,
+  0xFFFFFFFF, 0xC7C7C7FF, 0xFFFFFFFF, 0x838383FF, 0xFFFFFFFF, 0x010101FF, 0xFFFFFFFF, 0x010101FF,
+  0xFFFFFFFF, 0xC0C0C1FF, 0xFFFFFFFF, 0xE0E0E3FF, 0xFFFFFFFF, 0xF1F1FFFF, 0xFFFFFFFF, 0xE3E3FFFF,
+  0xFFFFFFFF, 0xC7C7FFFF, 0xFFFFFFFF, 0x8383E3FF, 0xFFFFFFFF, 0x0101C1FF, 0xFFFFFFFF, 0x0101C1FF
+};
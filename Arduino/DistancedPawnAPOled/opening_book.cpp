@@ -0,0 +1,55 @@
+/**
+ * @file opening_book.cpp
+ * @brief Binary search of the opening book in flash
+ */
+
+#include "opening_book.h"
+
+static_assert(sizeof(BookEntry) == 12, "A book record must be packed in 12 bytes");
+
+//! Hash of a record, read from flash
+static uint64_t bookKey(int i) {
+  return ((uint64_t)pgm_read_dword(&OPENING_BOOK[i].keyHigh) << 32) | pgm_read_dword(&OPENING_BOOK[i].keyLow);
+}
+
+int bookFind(uint64_t hash) {
+  int low = 0;
+  int high = OPENING_BOOK_SIZE;
+
+  // Lower bound: first record with a hash not smaller than the searched one
+  while (low < high) {
+    int middle = (low + high) / 2;
+    if (bookKey(middle) < hash) {
+      low = middle + 1;
+    }
+    else {
+      high = middle;
+    }
+  }
+  return (low < OPENING_BOOK_SIZE && bookKey(low) == hash) ? low : -1;
+}
+
+Move bookMove(const Board& board) {
+  uint64_t hash = board.getHash();
+  int first = bookFind(hash);
+  uint32_t total = 0;
+  int last;
+
+  if (first < 0) {
+    return MOVE_NONE;
+  }
+  for (last = first; last < OPENING_BOOK_SIZE && bookKey(last) == hash; last++) {
+    total += pgm_read_word(&OPENING_BOOK[last].weight);
+  }
+
+  // Every move is chosen with probability proportional to its weight
+  long pick = random(total);
+  for (int i = first; i < last; i++) {
+    Move m = pgm_read_word(&OPENING_BOOK[i].move);
+    pick -= pgm_read_word(&OPENING_BOOK[i].weight);
+    if (pick < 0) {
+      return (board.validate(m) == MOVE_OK) ? m : MOVE_NONE;
+    }
+  }
+  return MOVE_NONE;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file opening_book.h
+ * @brief Opening book stored in flash, looked up by the Zobrist hash
+ *
+ * The book is a table of (hash, move, weight) records sorted by hash, built
+ * on the host by the book_maker tool from a PGN collection. The table stays
+ * in flash (PROGMEM) and a position is looked up by binary search reading
+ * the records in place, without copying the book in RAM. When the position
+ * has more book moves one is chosen at random in proportion to its weight,
+ * so the sketch seeds random() with randomSeed() on start.
+ */
+
+#ifndef _OPENING_BOOK
+#define _OPENING_BOOK
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "chess_moves.h"
+
+/**
+ * A book move packed in 12 bytes. The hash is split in two halves so the
+ * record is 4-byte aligned, without the padding of a 64-bit member.
+ */
+struct BookEntry {
+  uint32_t keyHigh;   //!< Upper 32 bits of the Zobrist hash of the position
+  uint32_t keyLow;    //!< Lower 32 bits of the Zobrist hash of the position
+  Move move;          //!< The move played in the position
+  uint16_t weight;    //!< How good the move is, more games won give more weight
+};
+
+//! The book records, sorted by hash and by decreasing weight
+extern const BookEntry OPENING_BOOK[] PROGMEM;
+
+//! Number of records of the book
+extern const uint16_t OPENING_BOOK_SIZE;
+
+/**
+ * Find the first record of a position
+ *
+ * @param hash The Zobrist hash of the position
+ *
+ * @return The index of the first record, -1 if the position is not in the book
+ */
+int bookFind(uint64_t hash);
+
+/**
+ * Choose a book move for a position
+ *
+ * The moves are checked with validate(), so a wrong book or a hash collision
+ * never give an illegal move.
+ *
+ * @param board The position
+ *
+ * @return A legal move of the book, MOVE_NONE if the position is not in the book
+ */
+Move bookMove(const Board& board);
+
+#endif
@@ -0,0 +1,376 @@
+/**
+ * @file search.cpp
+ * @brief Iterative deepening alpha-beta search with quiescence
+ */
+
+#include "kpk.h"
+#include "opening_book.h"
+#include "search.h"
+#include "transposition.h"
+
+//! Score saved in the table: the mates are counted from the position, not from the root
+static int scoreToTable(int score, int ply) {
+  return (score >= SCORE_MATE_BOUND) ? score + ply : (score <= -SCORE_MATE_BOUND) ? score - ply : score;
+}
+
+//! Score read from the table, the mates counted again from the root
+static int scoreFromTable(int score, int ply) {
+  return (score >= SCORE_MATE_BOUND) ? score - ply : (score <= -SCORE_MATE_BOUND) ? score + ply : score;
+}
+
+//! Rank of the pieces in the MVV-LVA order, in ChessPiece order
+static const int8_t ORDER_RANK[EMPTY + 1] = { 6, 5, 3, 2, 4, 1, 0 };
+
+Move MovePicker::pick() {
+  if (next >= count) {
+    return MOVE_NONE;
+  }
+
+  // Bring the best of the remaining moves in the next position
+  int best = next;
+  for (int i = next + 1; i < count; i++) {
+    if (moves[i].score > moves[best].score) {
+      best = i;
+    }
+  }
+  ScoredMove m = moves[best];
+  moves[best] = moves[next];
+  moves[next] = m;
+  next++;
+  return m.move;
+}
+
+SearchResult Search::think(const Board& position, const SearchLimits& searchLimits) {
+  SearchResult result;
+  MoveList& list = generated;
+
+  board = position;
+  limits = searchLimits;
+  startTime = millis();
+  lastYield = startTime;
+  nodes = 0;
+  moveTop = 0;
+  ttProbes = 0;
+  ttHits = 0;
+  stopped = false;
+  if (limits.helper == 0) {
+    transpositionTable.newSearch();
+  }
+
+  // The killers belong to the previous position, the history keeps half its weight
+  memset(killers, 0, sizeof(killers));
+  for (int c = 0; c < 2; c++) {
+    for (int p = 0; p < EMPTY; p++) {
+      for (int s = 0; s < BOARD_SQUARES; s++) {
+        history[c][p][s] >>= 1;
+      }
+    }
+  }
+
+  // The book replies at once
+  if (limits.useBook && limits.helper == 0 && (result.best = bookMove(board)) != MOVE_NONE) {
+    result.elapsed = millis() - startTime;
+    return result;
+  }
+
+  // Any legal move is better than no move if the time runs out immediately
+  board.generateMoves(list);
+  if (list.count > 0) {
+    result.best = list.moves[0];
+  }
+  rootBest = result.best;
+
+  // Nothing to think about with a single legal move. The list is the scratch
+  // list of the search, so the count is read before the search reuses it.
+  int rootMoves = list.count;
+  for (int depth = 1 + (limits.helper & 1); rootMoves > 1 && depth <= limits.maxDepth && depth <= SEARCH_MAX_PLY; depth++) {
+    iterationBest = MOVE_NONE;
+    int score = alphaBeta(depth, 0, -SCORE_INFINITE, SCORE_INFINITE);
+
+    // The previous best move is searched first: a move found better in an
+    // interrupted iteration is better also at the new depth
+    if (iterationBest != MOVE_NONE) {
+      result.best = iterationBest;
+      rootBest = iterationBest;
+    }
+    if (stopped) {
+      break;
+    }
+    result.score = score;
+    result.depth = depth;
+
+    // The next iteration takes longer than all the previous ones together,
+    // and a forced mate will not change with a deeper search
+    if (millis() - startTime >= limits.timeMs / 2 || score >= SCORE_MATE_BOUND || score <= -SCORE_MATE_BOUND) {
+      break;
+    }
+  }
+
+  result.nodes = nodes;
+  result.ttProbes = ttProbes;
+  result.ttHits = ttHits;
+  result.elapsed = millis() - startTime;
+  return result;
+}
+
+int Search::alphaBeta(int depth, int ply, int alpha, int beta) {
+  MovePicker picker;
+  TTEntry entry;
+  Move hashMove = MOVE_NONE;
+  Move bestMove = MOVE_NONE;
+  int best = -SCORE_INFINITE;
+  int alphaStart = alpha;
+
+  // The quiescence search starts at the horizon, where the checks are
+  // answered by all the evasions. Before it, a check does not use depth.
+  if (depth <= 0) {
+    return quiescence(ply, alpha, beta);
+  }
+  if (board.inCheck()) {
+    depth++;
+  }
+  if (checkClock()) {
+    return 0;
+  }
+  nodes++;
+
+  path[ply] = board.getHash();
+  if (ply > 0 && (stateHalfmoves(board.getState()) >= 100 || isRepetition(ply))) {
+    return 0;
+  }
+  if (ply >= SEARCH_MAX_PLY) {
+    return evaluate();
+  }
+
+  // A result of the same depth or deeper can be reused if its bound fits the window
+  ttProbes++;
+  if (transpositionTable.probe(board.getHash(), entry)) {
+    ttHits++;
+    int score = scoreFromTable(entry.score, ply);
+    int bound = entry.flags & 3;
+    hashMove = entry.move;
+    if (ply > 0 && entry.depth >= depth &&
+        (bound == TT_BOUND_EXACT || (bound == TT_BOUND_LOWER && score >= beta) ||
+         (bound == TT_BOUND_UPPER && score <= alpha))) {
+      return score;
+    }
+  }
+
+  // The best move of the previous iteration, or the one stored in the table, goes first
+  int top = moveTop;
+  if (!orderMoves(picker, (ply == 0) ? rootBest : hashMove, ply, false)) {
+    return evaluate();
+  }
+  if (picker.count == 0) {
+    return board.inCheck() ? -SCORE_MATE + ply : 0;
+  }
+
+  for (Move m = picker.pick(); m != MOVE_NONE; m = picker.pick()) {
+    board.makeMove(m);
+    int score = -alphaBeta(depth - 1, ply + 1, -beta, -alpha);
+    board.unmakeMove();
+
+    if (stopped) {
+      moveTop = top;
+      return 0;
+    }
+    if (score > best) {
+      best = score;
+      if (ply == 0) {
+        iterationBest = m;
+      }
+      if (score > alpha) {
+        alpha = score;
+        bestMove = m;
+        if (alpha >= beta) {
+          if (isQuiet(m)) {
+            updateOrdering(m, depth, ply);
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  moveTop = top;
+  transpositionTable.store(board.getHash(), bestMove, scoreToTable(best, ply), depth,
+                           (best >= beta) ? TT_BOUND_LOWER : (best > alphaStart) ? TT_BOUND_EXACT : TT_BOUND_UPPER);
+  return best;
+}
+
+int Search::quiescence(int ply, int alpha, int beta) {
+  MovePicker picker;
+  bool inCheck = board.inCheck();
+  int best = -SCORE_INFINITE;
+
+  if (checkClock()) {
+    return 0;
+  }
+  nodes++;
+
+  if (ply >= SEARCH_MAX_PLY) {
+    return evaluate();
+  }
+
+  // Out of check the player can stand on the static score instead of capturing
+  if (!inCheck) {
+    best = evaluate();
+    if (best >= beta) {
+      return best;
+    }
+    if (best > alpha) {
+      alpha = best;
+    }
+  }
+
+  // Out of check keep only the captures and the promotions: the best captures
+  // first give the early cutoffs that keep the capture sequences short
+  int top = moveTop;
+  if (!orderMoves(picker, MOVE_NONE, ply, !inCheck)) {
+    return inCheck ? evaluate() : best;
+  }
+  if (inCheck && picker.count == 0) {
+    return -SCORE_MATE + ply;
+  }
+
+  for (Move m = picker.pick(); m != MOVE_NONE; m = picker.pick()) {
+    board.makeMove(m);
+    int score = -quiescence(ply + 1, -beta, -alpha);
+    board.unmakeMove();
+
+    if (stopped) {
+      moveTop = top;
+      return 0;
+    }
+    if (score > best) {
+      best = score;
+      if (score > alpha) {
+        alpha = score;
+        if (alpha >= beta) {
+          break;
+        }
+      }
+    }
+  }
+  moveTop = top;
+  return best;
+}
+
+bool Search::orderMoves(MovePicker& picker, Move hashMove, int ply, bool noisyOnly) {
+  MoveList& list = generated;
+  ChessColor us = board.getTurn();
+  int count = 0;
+
+  // The quiescence search generates only the captures and the promotions
+  board.generateMoves(list, noisyOnly ? board.noisyTargets() : ~(Bitboard)0);
+  picker.moves = moveStack + moveTop;
+  picker.next = 0;
+
+  for (int i = 0; i < list.count; i++) {
+    Move m = list.moves[i];
+    int16_t score;
+
+    if (m == hashMove) {
+      score = ORDER_HASH_MOVE;
+    }
+    else if (!isQuiet(m)) {
+      // The en passant victim is a pawn, a promotion counts as capturing the new piece
+      ChessPiece victim = (moveFlags(m) == MOVE_FLAG_EN_PASSANT) ? PAWN : codePiece(board.getPieceCode(moveTo(m)));
+      int value = ORDER_RANK[victim] + ((moveFlags(m) == MOVE_FLAG_PROMOTION) ? ORDER_RANK[movePromotion(m)] : 0);
+      score = ORDER_CAPTURE + 16 * value - ORDER_RANK[codePiece(board.getPieceCode(moveFrom(m)))];
+    }
+    else if (noisyOnly) {
+      // A quiet move of a piece to the promotion rank
+      continue;
+    }
+    else if (m == killers[ply][0]) {
+      score = ORDER_KILLER;
+    }
+    else if (m == killers[ply][1]) {
+      score = ORDER_KILLER - 1;
+    }
+    else {
+      score = history[us][codePiece(board.getPieceCode(moveFrom(m)))][moveTo(m)];
+    }
+
+    if (moveTop + count >= SEARCH_MOVE_STACK) {
+      picker.count = 0;
+      return false;
+    }
+    picker.moves[count].move = m;
+    picker.moves[count++].score = score;
+  }
+  picker.count = count;
+  moveTop += count;
+  return true;
+}
+
+void Search::updateOrdering(Move m, int depth, int ply) {
+  uint16_t& h = history[board.getTurn()][codePiece(board.getPieceCode(moveFrom(m)))][moveTo(m)];
+
+  if (killers[ply][0] != m) {
+    killers[ply][1] = killers[ply][0];
+    killers[ply][0] = m;
+  }
+
+  // Deep cutoffs weight more; the whole table is halved to keep the scores in range
+  h += depth * depth;
+  if (h >= HISTORY_MAX) {
+    for (int c = 0; c < 2; c++) {
+      for (int p = 0; p < EMPTY; p++) {
+        for (int s = 0; s < BOARD_SQUARES; s++) {
+          history[c][p][s] >>= 1;
+        }
+      }
+    }
+  }
+}
+
+bool Search::isQuiet(Move m) {
+  return board.getPieceCode(moveTo(m)) == NO_PIECE &&
+         moveFlags(m) != MOVE_FLAG_EN_PASSANT && moveFlags(m) != MOVE_FLAG_PROMOTION;
+}
+
+int Search::evaluate() {
+  int score = board.evaluate();
+
+  // The King and pawn against King endings have an exact verdict
+  switch (kpkProbe(board)) {
+    case KPK_DRAW:
+      return 0;
+    case KPK_WIN:
+      return score + (board.getPieces(PAWN, board.getTurn()) ? SCORE_KNOWN_WIN : -SCORE_KNOWN_WIN);
+  }
+  return score;
+}
+
+bool Search::isRepetition(int ply) {
+  // Only the positions with the same player in turn and after the last
+  // capture or pawn move can repeat
+  int limit = stateHalfmoves(board.getState());
+
+  for (int i = ply - 4; i >= 0 && ply - i <= limit; i -= 2) {
+    if (path[i] == path[ply]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Search::checkClock() {
+  if (stopped) {
+    return true;
+  }
+  if ((nodes & (SEARCH_CLOCK_NODES - 1)) == 0) {
+    unsigned long now = millis();
+    if (now - startTime >= limits.timeMs || (limits.stop != NULL && __atomic_load_n(limits.stop, __ATOMIC_RELAXED))) {
+      stopped = true;
+      return true;
+    }
+    if (limits.yield != NULL && now - lastYield >= limits.sliceMs) {
+      limits.yield();
+      lastYield = millis();
+    }
+  }
+  return false;
+}
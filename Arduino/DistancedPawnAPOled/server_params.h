@@ -11,9 +11,15 @@
 //! https custom server port
 #define SERVER_PORT 8080
 
+//! Clients served at the same time, e.g. the remote board, a browser and a spectator
+#define SERVER_CLIENTS 4
+
 //! Delay before the AP can connect the WiFi (ms)
 #define AP_DELAY 10000
 
+//! Analog pin left unconnected: its noise seeds the random choice of the book moves
+#define RANDOM_SEED_PIN A0
+
 //! Definition of the default AP IP address
 inline int IP(int x) { int ip[] = {10, 0, 0, 1}; return ip[x]; }
 
@@ -21,3 +27,38 @@ inline int IP(int x) { int ip[] = {10, 0, 0, 1}; return ip[x]; }
 #define HTTPGET_NEWGAME     "/N"
 #define HTTPGET_MOVE        "/M"
 #define HTTPGET_STATUS      "/S"
+#define HTTPGET_EVENTS      "/E"
+#define HTTPGET_COMPUTER    "/C"
+
+//! Status extension: "/S?t=e2" answers the legal destinations of the piece
+//! on e2 as 16 hexadecimal digits, bit 0 being A1
+#define HTTPGET_STATUS_TARGETS "/S?t="
+
+//! Status extension: "/S?f" answers the position in FEN instead of the packed board
+#define HTTPGET_STATUS_FEN "/S?f"
+
+//! Status extension: "/S?since=00012" answers when the sequence number is not
+//! 12 any more, or after HTTP_LONG_POLL_MS with the same position
+#define HTTPGET_STATUS_SINCE "/S?since="
+
+// Answers of the game requests, fields separated by a single space:
+//   "/N"              "SSSSS C G"
+//   "/M?e2e4"         "RR SSSSS C G"
+//   "/S"              "SSSSS C G BOARD"
+//   "/S?f"            "SSSSS C G FEN"
+//   "/S?since=SSSSS"  "SSSSS C G BOARD"
+//   "/E"              Server-Sent Events stream, every event is "data: SSSSS C G BOARD"
+//   "/C"              "RR SSSSS C G", the computer moves later and the sequence number changes
+// SSSSS  sequence number of the position, five digits, incremented by every
+//        new game and every move done
+// C      player in turn, "w" or "b"
+// G      GAME_* status of chess_moves.h, one digit
+// RR     MOVE_* code of the move, two digits, "00" when the move is done
+// BOARD  64 characters from A1 to H8, the FEN letters and '.' for the empty squares
+// FEN    the position in Forsyth-Edwards Notation
+
+//! Thinking time of the computer opponent (ms)
+#define COMPUTER_TIME_MS 5000
+
+//! Longest time the computer thinks before serving the web clients again (ms)
+#define COMPUTER_SLICE_MS 20
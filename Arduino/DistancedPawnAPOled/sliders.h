@@ -0,0 +1,124 @@
+/**
+ * @file sliders.h
+ * @brief Attacks of the sliding pieces (rook, bishop and queen)
+ *
+ * Two backends are available and one of them is selected at compile time:
+ * <ul>
+ * <li>SLIDERS_KOGGE_STONE: table-free parallel prefix (Kogge-Stone) fill of the
+ * eight rays. It needs no memory and is the default on the micro controller
+ * <li>SLIDERS_MAGIC: magic bitboards lookup. The tables take about 840 KB, so
+ * it is the default of the host builds only
+ * </ul>
+ * Define one of the two symbols before compiling to force the backend. The
+ * Kogge-Stone functions are always available, as they are also the reference
+ * used to build the magic tables.
+ */
+
+#ifndef _SLIDERS
+#define _SLIDERS
+
+#include "bitboard.h"
+
+#if !defined(SLIDERS_KOGGE_STONE) && !defined(SLIDERS_MAGIC)
+#ifdef ARDUINO
+#define SLIDERS_KOGGE_STONE
+#else
+#define SLIDERS_MAGIC
+#endif
+#endif
+
+/**
+ * Prepare the tables of the selected backend.
+ *
+ * It is called by the Board constructor, so the tables are ready before any
+ * board is used, also by the boards built during the static initialization.
+ * Later calls do nothing.
+ */
+void initSliders();
+
+/**
+ * Rook attacks calculated with the Kogge-Stone fill
+ *
+ * @param s The square of the rook
+ * @param occupied The occupied squares of the board
+ *
+ * @return The attacked squares, including the first blocker of every ray
+ */
+Bitboard koggeRookAttacks(uint8_t s, Bitboard occupied);
+
+/**
+ * Bishop attacks calculated with the Kogge-Stone fill
+ *
+ * @param s The square of the bishop
+ * @param occupied The occupied squares of the board
+ *
+ * @return The attacked squares, including the first blocker of every ray
+ */
+Bitboard koggeBishopAttacks(uint8_t s, Bitboard occupied);
+
+#ifdef SLIDERS_MAGIC
+//! Magic bitboard entry of a square
+struct SliderMagic {
+  Bitboard mask;      //!< Relevant occupancy, the rays without the board edges
+  Bitboard magic;     //!< Multiplier mapping the relevant occupancy to an index
+  Bitboard* attacks;  //!< First entry of the square in the shared attack table
+  uint8_t shift;      //!< 64 minus the number of relevant bits
+};
+
+extern SliderMagic rookMagics[BOARD_SQUARES];
+extern SliderMagic bishopMagics[BOARD_SQUARES];
+
+//! Attacks lookup of a magic bitboard entry
+inline Bitboard magicAttacks(const SliderMagic& m, Bitboard occupied) {
+  return m.attacks[((occupied & m.mask) * m.magic) >> m.shift];
+}
+
+//! Rook attacks from the magic bitboard tables
+inline Bitboard magicRookAttacks(uint8_t s, Bitboard occupied) {
+  return magicAttacks(rookMagics[s], occupied);
+}
+
+//! Bishop attacks from the magic bitboard tables
+inline Bitboard magicBishopAttacks(uint8_t s, Bitboard occupied) {
+  return magicAttacks(bishopMagics[s], occupied);
+}
+#endif
+
+/**
+ * Rook attacks with the selected backend
+ *
+ * @param s The square of the rook
+ * @param occupied The occupied squares of the board
+ *
+ * @return The attacked squares, including the first blocker of every ray
+ */
+inline Bitboard rookAttacks(uint8_t s, Bitboard occupied) {
+#ifdef SLIDERS_MAGIC
+  return magicRookAttacks(s, occupied);
+#else
+  return koggeRookAttacks(s, occupied);
+#endif
+}
+
+/**
+ * Bishop attacks with the selected backend
+ *
+ * @param s The square of the bishop
+ * @param occupied The occupied squares of the board
+ *
+ * @return The attacked squares, including the first blocker of every ray
+ */
+inline Bitboard bishopAttacks(uint8_t s, Bitboard occupied) {
+#ifdef SLIDERS_MAGIC
+  return magicBishopAttacks(s, occupied);
+#else
+  return koggeBishopAttacks(s, occupied);
+#endif
+}
+
+//! Queen attacks are the union of the rook and bishop attacks
+inline Bitboard queenAttacks(uint8_t s, Bitboard occupied) {
+  return rookAttacks(s, occupied) | bishopAttacks(s, occupied);
+}
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * @file transposition.h
+ * @brief Transposition table of the search, keyed by the Zobrist hash
+ *
+ * The table remembers the outcome of the positions already searched, so a
+ * position reached again by a different order of moves is not searched twice.
+ * Its memory is fixed at compile time by TT_SIZE_BYTES: the entries are packed
+ * in 8 bytes and grouped in buckets of TT_BUCKET_ENTRIES, and when a bucket is
+ * full the shallowest or oldest entry is replaced.
+ *
+ * On the host the table is shared by the threads of the Lazy SMP search
+ * without locks: every entry is read and written as a single 64-bit word, so
+ * a thread never sees half an entry written by another one.
+ */
+
+#ifndef _TRANSPOSITION
+#define _TRANSPOSITION
+
+#include <stdint.h>
+
+#include "chess_moves.h"
+
+//! Memory of the table, a power of two. It can be overridden by the build.
+#ifndef TT_SIZE_BYTES
+#ifdef ARDUINO
+#define TT_SIZE_BYTES 4096UL
+#else
+#define TT_SIZE_BYTES (64UL << 20)
+#endif
+#endif
+
+//! Entries sharing the same index, half a cache line on the host
+#define TT_BUCKET_ENTRIES 4
+
+#define TT_BOUND_NONE      0   //!< Empty entry
+#define TT_BOUND_LOWER     1   //!< The score is at least the stored one (beta cutoff)
+#define TT_BOUND_UPPER     2   //!< The score is at most the stored one (no move raised alpha)
+#define TT_BOUND_EXACT     3   //!< The score is exact
+
+//! Entries considered by the fill level estimate
+#define TT_FILL_SAMPLE 1000
+
+//! A searched position packed in 8 bytes
+struct TTEntry {
+  uint16_t key;       //!< Upper 16 bits of the hash, the lower ones select the bucket
+  Move move;          //!< Best move found, MOVE_NONE if none
+  int16_t score;      //!< Score, mates counted from the position
+  uint8_t depth;      //!< Depth of the search
+  uint8_t flags;      //!< TT_BOUND_* in bits 0-1, search generation in bits 2-7
+};
+
+//! The entries sharing the same index, every TTEntry packed in a word
+struct TTBucket {
+  uint64_t entries[TT_BUCKET_ENTRIES];
+};
+
+//! Number of buckets of the table
+#define TT_BUCKETS (TT_SIZE_BYTES / sizeof(TTBucket))
+
+/**
+ * The TranspositionTable class stores the search results in a fixed array,
+ * with no dynamic memory.
+ *
+ * The table is meant to be a global variable: the buckets are empty when the
+ * memory is zeroed, so it does not need to be cleared on start.
+ */
+class TranspositionTable {
+  //! The table
+  TTBucket buckets[TT_BUCKETS];
+
+  //! Generation of the current search, to recognize the entries of the old ones
+  uint8_t generation;
+
+public:
+  //! Empty the table, e.g. when a new game starts
+  void clear();
+
+  //! Start a new search: the entries of the previous ones become replaceable
+  void newSearch();
+
+  /**
+   * Look up a position
+   *
+   * @param hash The Zobrist hash of the position
+   * @param entry The stored entry, when found
+   *
+   * @return true if the position has been found
+   */
+  bool probe(uint64_t hash, TTEntry& entry);
+
+  /**
+   * Save the result of a search. A deeper entry of the same position and
+   * of the current search is kept, with the new move, unless the new bound
+   * is exact.
+   *
+   * @param hash The Zobrist hash of the position
+   * @param move The best move, MOVE_NONE keeps the move already stored
+   * @param score The score
+   * @param depth The depth searched
+   * @param bound One of the TT_BOUND_* types
+   */
+  void store(uint64_t hash, Move move, int score, int depth, int bound);
+
+  //! Entries written by the current search per thousand, estimated on a sample
+  int fillPermille() const;
+};
+
+//! The table shared by the searches
+extern TranspositionTable transpositionTable;
+
+#endif
@@ -0,0 +1,31 @@
+/**
+  \file DistancedPawnPerft.ino
+  \brief Perft benchmark and correctness test of the chess core on the board
+
+  Cut-down sketch running the perft reference suite on the Arduino MKR1010,
+  with no WiFi nor display. The results, speed included, are printed on
+  the USB serial port. The chess core files are the same of the AP sketches.
+
+  \author Enrico Miglino <balearidcynamics@gmail.com>
+  \version 1.0 build 1
+ */
+
+#include <Streaming.h>
+
+#include "chess_moves.h"
+#include "perft.h"
+
+//! Deepest depth run on the board, deeper levels take too long at 48 MHz
+#define PERFT_BOARD_DEPTH 3
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+
+  Serial << "Distanced Pawn perft, depth " << PERFT_BOARD_DEPTH << endl;
+  int failures = runPerftSuite(&Serial, PERFT_BOARD_DEPTH, true);
+  Serial << endl << (failures ? "Some checks FAILED" : "All checks passed") << endl;
+}
+
+void loop() {
+}
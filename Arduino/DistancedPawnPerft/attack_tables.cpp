@@ -0,0 +1,42 @@
+/**
+ * @file attack_tables.cpp
+ * @brief Compile-time generation of the leaper attack tables
+ */
+
+#include "attack_tables.h"
+
+//! Expand the generator f for the 8 squares of the row r
+#define ATTACK_TABLE_ROW(f, r) \
+  f(8 * r + 0), f(8 * r + 1), f(8 * r + 2), f(8 * r + 3), \
+  f(8 * r + 4), f(8 * r + 5), f(8 * r + 6), f(8 * r + 7)
+
+//! Expand the generator f for all the squares of the board
+#define ATTACK_TABLE(f) \
+  ATTACK_TABLE_ROW(f, 0), ATTACK_TABLE_ROW(f, 1), ATTACK_TABLE_ROW(f, 2), ATTACK_TABLE_ROW(f, 3), \
+  ATTACK_TABLE_ROW(f, 4), ATTACK_TABLE_ROW(f, 5), ATTACK_TABLE_ROW(f, 6), ATTACK_TABLE_ROW(f, 7)
+
+// Single argument generators for the pawn tables of each color
+constexpr Bitboard whitePawnCaptures(int s) { return pawnCaptureTargets(0, s); }
+constexpr Bitboard blackPawnCaptures(int s) { return pawnCaptureTargets(1, s); }
+constexpr Bitboard whitePawnPushes(int s) { return pawnPushTargets(0, s); }
+constexpr Bitboard blackPawnPushes(int s) { return pawnPushTargets(1, s); }
+
+// Spot checks of the generators, evaluated by the compiler
+static_assert(knightTargets(0) == 0x0000000000020400ULL, "Wrong knight table on A1");
+static_assert(kingTargets(63) == 0x40C0000000000000ULL, "Wrong king table on H8");
+static_assert(whitePawnCaptures(12) == 0x0000000000280000ULL, "Wrong white pawn table on E2");
+static_assert(blackPawnPushes(52) == 0x0000100000000000ULL, "Wrong black pawn table on E7");
+
+constexpr Bitboard KNIGHT_ATTACKS[BOARD_SQUARES] = { ATTACK_TABLE(knightTargets) };
+
+constexpr Bitboard KING_ATTACKS[BOARD_SQUARES] = { ATTACK_TABLE(kingTargets) };
+
+constexpr Bitboard PAWN_ATTACKS[2][BOARD_SQUARES] = {
+  { ATTACK_TABLE(whitePawnCaptures) },
+  { ATTACK_TABLE(blackPawnCaptures) }
+};
+
+constexpr Bitboard PAWN_PUSHES[2][BOARD_SQUARES] = {
+  { ATTACK_TABLE(whitePawnPushes) },
+  { ATTACK_TABLE(blackPawnPushes) }
+};
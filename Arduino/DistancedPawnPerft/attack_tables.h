@@ -0,0 +1,72 @@
+/**
+ * @file attack_tables.h
+ * @brief Precomputed attack tables of the leaper pieces (knight, king and pawns)
+ *
+ * The tables are generated at compile time by the constexpr functions below and
+ * stored as constant data, so on the MKR1010 they stay in flash and not in SRAM.
+ * Checking a leaper move is a table lookup and an AND with the destination mask.
+ * The same tables are used by the move validation, the move generator and the
+ * attack detection.
+ */
+
+#ifndef _ATTACK_TABLES
+#define _ATTACK_TABLES
+
+#include "bitboard.h"
+
+/**
+ * Destination square of a single leap, if it is on the board
+ *
+ * @param x, y The coordinates of the starting square
+ * @param dx, dy The leap offsets
+ *
+ * @return The destination square mask or an empty set if outside of the board
+ */
+constexpr Bitboard leaperTarget(int x, int y, int dx, int dy) {
+  return (x + dx < 0 || x + dx > 7 || y + dy < 0 || y + dy > 7) ?
+    0 : (Bitboard)1 << ((y + dy) * 8 + x + dx);
+}
+
+//! Squares reached by a knight on the square s
+constexpr Bitboard knightTargets(int s) {
+  return leaperTarget(s & 7, s >> 3, 1, 2) | leaperTarget(s & 7, s >> 3, 2, 1) |
+         leaperTarget(s & 7, s >> 3, 2, -1) | leaperTarget(s & 7, s >> 3, 1, -2) |
+         leaperTarget(s & 7, s >> 3, -1, -2) | leaperTarget(s & 7, s >> 3, -2, -1) |
+         leaperTarget(s & 7, s >> 3, -2, 1) | leaperTarget(s & 7, s >> 3, -1, 2);
+}
+
+//! Squares reached by a king on the square s
+constexpr Bitboard kingTargets(int s) {
+  return leaperTarget(s & 7, s >> 3, 0, 1) | leaperTarget(s & 7, s >> 3, 1, 1) |
+         leaperTarget(s & 7, s >> 3, 1, 0) | leaperTarget(s & 7, s >> 3, 1, -1) |
+         leaperTarget(s & 7, s >> 3, 0, -1) | leaperTarget(s & 7, s >> 3, -1, -1) |
+         leaperTarget(s & 7, s >> 3, -1, 0) | leaperTarget(s & 7, s >> 3, -1, 1);
+}
+
+//! Row direction of the pawns of the color c (0 is white, 1 is black)
+constexpr int pawnDirection(int c) { return c == 0 ? 1 : -1; }
+
+//! Squares captured by a pawn of the color c on the square s
+constexpr Bitboard pawnCaptureTargets(int c, int s) {
+  return leaperTarget(s & 7, s >> 3, -1, pawnDirection(c)) |
+         leaperTarget(s & 7, s >> 3, 1, pawnDirection(c));
+}
+
+//! Square reached by the single push of a pawn of the color c on the square s
+constexpr Bitboard pawnPushTargets(int c, int s) {
+  return leaperTarget(s & 7, s >> 3, 0, pawnDirection(c));
+}
+
+//! Knight attacks, indexed by square
+extern const Bitboard KNIGHT_ATTACKS[BOARD_SQUARES];
+
+//! King attacks, indexed by square
+extern const Bitboard KING_ATTACKS[BOARD_SQUARES];
+
+//! Pawn capture squares, indexed by color and square
+extern const Bitboard PAWN_ATTACKS[2][BOARD_SQUARES];
+
+//! Pawn single push squares, indexed by color and square
+extern const Bitboard PAWN_PUSHES[2][BOARD_SQUARES];
+
+#endif
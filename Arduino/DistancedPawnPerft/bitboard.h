@@ -0,0 +1,82 @@
+/**
+ * @file bitboard.h
+ * @brief 64-bit square sets used by the board representation
+ *
+ * Every set of squares is stored in a single 64-bit word, one bit per square.
+ * The square index is y * 8 + x, so bit 0 is A1, bit 7 is H1 and bit 63 is H8,
+ * with x the column (A..H) and y the row (1..8) as used by the Board class.
+ */
+
+#ifndef _BITBOARD
+#define _BITBOARD
+
+#include <stdint.h>
+
+//! A set of squares, one bit per square
+typedef uint64_t Bitboard;
+
+//! Number of squares on the board
+#define BOARD_SQUARES 64
+
+//! Square index from the board coordinates
+inline uint8_t squareAt(int x, int y) { return (uint8_t)((y << 3) | x); }
+
+//! Column (x coordinate) of a square index
+inline int squareX(uint8_t s) { return s & 7; }
+
+//! Row (y coordinate) of a square index
+inline int squareY(uint8_t s) { return s >> 3; }
+
+//! Set containing only the square s
+inline Bitboard squareMask(uint8_t s) { return (Bitboard)1 << s; }
+
+//! Number of squares in the set
+inline int popCount(Bitboard b) { return __builtin_popcountll(b); }
+
+//! Lowest square index of a non-empty set
+inline uint8_t firstSquare(Bitboard b) { return (uint8_t)__builtin_ctzll(b); }
+
+/**
+ * Remove the lowest square from a non-empty set
+ *
+ * @param b The set, updated in place
+ *
+ * @return The index of the removed square
+ */
+inline uint8_t popFirstSquare(Bitboard& b) {
+  uint8_t s = firstSquare(b);
+  b &= b - 1;
+  return s;
+}
+
+/**
+ * Squares strictly between two squares on the same row, column or diagonal.
+ *
+ * The mask is calculated without loops nor tables: the line through the two
+ * squares is built from the unit lines of the four directions and then clipped
+ * to the range between them.
+ *
+ * @param a, b The two square indexes
+ *
+ * @return The in-between squares, or an empty set if the squares are not aligned
+ * or adjacent
+ */
+inline Bitboard squaresBetween(uint8_t a, uint8_t b) {
+  const Bitboard allSquares = ~(Bitboard)0;
+  const Bitboard a2a7 = 0x0001010101010100ULL;
+  const Bitboard b2g7 = 0x0040201008040200ULL;
+  const Bitboard h1b7 = 0x0002040810204080ULL;
+
+  Bitboard between = (allSquares << a) ^ (allSquares << b);
+  Bitboard file = (Bitboard)((b & 7) - (a & 7));
+  Bitboard rank = (Bitboard)(((b | 7) - a) >> 3);
+  Bitboard line = ((file & 7) - 1) & a2a7;
+  line += 2 * (((rank & 7) - 1) >> 58);
+  line += (((rank - file) & 15) - 1) & b2g7;
+  line += (((rank + file) & 15) - 1) & h1b7;
+  line *= between & (0 - between);
+
+  return line & between;
+}
+
+#endif
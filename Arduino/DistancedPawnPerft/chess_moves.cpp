@@ -0,0 +1,1179 @@
+/**
+ * @file chess_moves.cpp
+ * @brief Class that manages the moves and the board
+ */
+
+#include <stdio.h>
+
+#include "chess_moves.h"
+#include "attack_tables.h"
+#include "evaluation.h"
+#include "sliders.h"
+#include "zobrist.h"
+
+// ----------------------------------------------------- Square class
+Square::Square() {
+  code = NO_PIECE;
+  index = 0;
+}
+
+Square::Square(ChessPiece p, ChessColor c, int ex, int why) {
+  code = pieceCode(p, c);
+  index = squareAt(ex, why);
+}
+
+void Square::setSpace(Square* space) {
+  code = space->code;
+}
+
+void Square::setEmpty() {
+  code = NO_PIECE;
+}
+
+ChessPiece Square::getPiece() {
+  return codePiece(code);
+}
+
+ChessColor Square::getPieceColor() {
+  return codeColor(code);
+}
+
+void Square::setPieceAndColor(ChessPiece p, ChessColor c) {
+  code = pieceCode(p, c);
+}
+
+// ----------------------------------------------------- Move functions
+void moveToText(Move m, char* text) {
+  const char promotions[] = "qbnr";
+
+  text[0] = 'a' + squareX(moveFrom(m));
+  text[1] = '1' + squareY(moveFrom(m));
+  text[2] = 'a' + squareX(moveTo(m));
+  text[3] = '1' + squareY(moveTo(m));
+  if (moveFlags(m) == MOVE_FLAG_PROMOTION) {
+    text[4] = promotions[movePromotion(m) - QUEEN];
+    text[5] = '\0';
+  }
+  else {
+    text[4] = '\0';
+  }
+}
+
+int textToSquare(const char* text) {
+  if (text[0] < 'a' || text[0] > 'h' || text[1] < '1' || text[1] > '8') {
+    return -1;
+  }
+  return squareAt(text[0] - 'a', text[1] - '1');
+}
+
+void bitboardToText(Bitboard b, char* text) {
+  const char digits[] = "0123456789abcdef";
+
+  for (int i = 15; i >= 0; i--) {
+    text[i] = digits[b & 15];
+    b >>= 4;
+  }
+  text[16] = '\0';
+}
+
+// ----------------------------------------------------- Castling helpers
+//! Castling rights kept when a piece leaves or lands on a square
+static int castlingKept(uint8_t s) {
+  switch (s) {
+    case 0:  return ~CASTLE_WHITE_QUEEN & 15;                        // A1
+    case 4:  return ~(CASTLE_WHITE_KING | CASTLE_WHITE_QUEEN) & 15;  // E1
+    case 7:  return ~CASTLE_WHITE_KING & 15;                         // H1
+    case 56: return ~CASTLE_BLACK_QUEEN & 15;                        // A8
+    case 60: return ~(CASTLE_BLACK_KING | CASTLE_BLACK_QUEEN) & 15;  // E8
+    case 63: return ~CASTLE_BLACK_KING & 15;                         // H8
+    default: return 15;
+  }
+}
+
+//! Start square of the Rook of a castling, from the King destination
+static uint8_t castlingRookFrom(uint8_t kingTo) {
+  return (squareX(kingTo) == 6) ? kingTo + 1 : kingTo - 2;
+}
+
+//! Destination of the Rook of a castling, from the King destination
+static uint8_t castlingRookTo(uint8_t kingTo) {
+  return (squareX(kingTo) == 6) ? kingTo - 1 : kingTo + 1;
+}
+
+/**
+ * Read a decimal number of a FEN field, skipping the spaces before it
+ *
+ * @param text The text, moved after the number
+ * @param missing The value returned when there is no number
+ *
+ * @return The number read
+ */
+static int readFenNumber(const char*& text, int missing) {
+  int n = 0;
+
+  while (*text == ' ') {
+    text++;
+  }
+  if (*text < '0' || *text > '9') {
+    return missing;
+  }
+  while (*text >= '0' && *text <= '9') {
+    n = n * 10 + (*text++ - '0');
+  }
+  return n;
+}
+
+//! FEN letter of a piece, uppercase for white
+static char fenLetter(PieceCode pc) {
+  char letter = "kqbnrp"[codePiece(pc)];
+  return (codeColor(pc) == PLAY_WHITE) ? letter - 'a' + 'A' : letter;
+}
+
+// --------------------------------------------------------------------- Borad class
+Board::Board() {
+  initSliders();
+  clearBoard();
+}
+
+void Board::clearBoard() {
+  for (int i = KING; i < EMPTY; i++) {
+    pieces[i] = 0;
+  }
+  colors[PLAY_WHITE] = 0;
+  colors[PLAY_BLACK] = 0;
+  for (int s = 0; s < BOARD_SQUARES; s++) {
+    mailbox[s] = NO_PIECE;
+  }
+  hash = 0;
+  scoreMg = 0;
+  scoreEg = 0;
+  phase = 0;
+  state = packState(0, NO_EN_PASSANT, 0, 1);
+  historyTop = 0;
+  historyCount = 0;
+  turn = PLAY_WHITE;
+  updateCheckInfo();
+}
+
+void Board::putPiece(uint8_t s, ChessPiece p, ChessColor c) {
+  Bitboard mask = squareMask(s);
+  PieceCode old = mailbox[s];
+
+  // Remove the piece already on the square, if any
+  if (old != NO_PIECE) {
+    pieces[codePiece(old)] &= ~mask;
+    colors[codeColor(old)] &= ~mask;
+    hash ^= ZOBRIST_PIECES[codeColor(old)][codePiece(old)][s];
+    scorePiece(old, s, -1);
+  }
+
+  mailbox[s] = pieceCode(p, c);
+  if (mailbox[s] != NO_PIECE) {
+    pieces[p] |= mask;
+    colors[c] |= mask;
+    hash ^= ZOBRIST_PIECES[c][p][s];
+    scorePiece(mailbox[s], s, 1);
+  }
+}
+
+void Board::scorePiece(PieceCode pc, uint8_t s, int sign) {
+  ChessColor c = codeColor(pc);
+  ChessPiece p = codePiece(pc);
+
+  scoreMg += sign * PIECE_SQUARE_MG[c][p][s];
+  scoreEg += sign * PIECE_SQUARE_EG[c][p][s];
+  phase += sign * PIECE_PHASE[p];
+}
+
+void Board::setState(int castling, int epFile, int halfmoves, int fullmoves) {
+  // The en passant square is hashed only when the capture is possible, so the
+  // same position reached by different moves has the same hash
+  if (epFile != NO_EN_PASSANT) {
+    uint8_t ep = squareAt(epFile, turn == PLAY_WHITE ? 5 : 2);
+    if (!(PAWN_ATTACKS[turn ^ 1][ep] & pieces[PAWN] & colors[turn])) {
+      epFile = NO_EN_PASSANT;
+    }
+  }
+
+  hash ^= ZOBRIST_CASTLING[stateCastling(state)] ^ ZOBRIST_CASTLING[castling];
+  if (stateEpFile(state) != NO_EN_PASSANT) {
+    hash ^= ZOBRIST_EN_PASSANT[stateEpFile(state)];
+  }
+  if (epFile != NO_EN_PASSANT) {
+    hash ^= ZOBRIST_EN_PASSANT[epFile];
+  }
+  state = packState(castling, epFile, halfmoves, fullmoves);
+}
+
+int Board::validCastling(int castling) const {
+  //! King and Rook start squares of every castling, in CASTLE_* bits order
+  const uint8_t kingHome[4] = { 4, 4, 60, 60 };
+  const uint8_t rookHome[4] = { 7, 0, 63, 56 };
+
+  for (int i = 0; i < 4; i++) {
+    ChessColor c = (i < 2) ? PLAY_WHITE : PLAY_BLACK;
+    if (mailbox[kingHome[i]] != pieceCode(KING, c) || mailbox[rookHome[i]] != pieceCode(ROOK, c)) {
+      castling &= ~(1 << i);
+    }
+  }
+  return castling;
+}
+
+void Board::movePiece(uint8_t from, uint8_t to) {
+  PieceCode moved = mailbox[from];
+
+  putPiece(to, codePiece(moved), codeColor(moved));
+  putPiece(from, EMPTY, PLAY_NONE);
+}
+
+Square Board::getSquare(int x, int y) {
+  uint8_t s = squareAt(x, y);
+
+  return Square(pieceOn(s), colorOn(s), x, y);
+}
+
+void Board::drawBoard(int t, Print* out) {
+  switch(t) {
+    // Board output to serial console
+    case BOARD_SERIAL:
+      drawSerialBoard(out);
+    break;
+    
+    // Board output to remote http client
+    case BOARD_HTML:
+    
+    break;
+
+    // Board output to the controller display
+    case BOARD_DISPLAY:
+    
+    break;
+  }
+}
+
+void Board::drawSerialBoard(Print* out) {
+  // Add an empty line
+  *out << endl << "      = Game Status =" << endl << endl;
+  // Loop by row and columns
+  for (int i = 7; i >= 0; i--) {
+    *out << " " << i + 1 << "| ";
+    for (int j = 0; j < 8; j++) {
+      // Draw the squares with the ChessPieces on them
+      ChessPiece p = pieceOn(squareAt(j, i));
+      ChessColor c = colorOn(squareAt(j, i));
+      switch (p)
+      {
+      case KING: (c == PLAY_WHITE) ? *out << "[K]" : *out << "[k]";
+        break;
+      case QUEEN: (c == PLAY_WHITE) ? *out << "[Q]" : *out << "[q]";
+        break;
+      case BISHOP:(c == PLAY_WHITE) ? *out << "[B]" : *out << "[b]";
+        break;
+      case KNIGHT:(c == PLAY_WHITE) ? *out << "[H]" : *out << "[h]";
+        break;
+      case ROOK: (c == PLAY_WHITE) ? *out << "[R]" : *out << "[r]";
+        break;
+      case PAWN: (c == PLAY_WHITE) ? *out << "[P]" : *out << "[p]";
+        break;
+      case EMPTY: *out << "[ ]";
+        break;
+      default: *out << "???"; // Should never happen
+        break;
+      } // Case piece
+    } // print row
+    *out << endl;
+  } // print col
+  // Last row
+  *out << "    ________________________" << endl;
+  *out << "     A  B  C  D  E  F  G  H" << endl;
+}
+
+void Board::drawHtmlBoard() {
+
+  // Not yet implemented
+
+}
+
+void Board::drawDisplayBoard() {
+
+  // Not yet available.
+
+}
+
+bool Board::doMove() {
+//  string move;
+//  int x1, x2, y1, y2;
+//  bool stop = false;
+//  while (!stop)
+//  {
+//    (turn == PLAY_WHITE) ? cout << "White's turn" << endl : cout << "Black's turn" << endl;
+//    cout << "Type in your move as a single four character string. Use x-coordinates first in each pair." << endl;
+//    cin >> move;
+//    x1 = move[0] - 48;
+//    y1 = move[1] - 48;
+//    x2 = move[2] - 48;
+//    y2 = move[3] - 48;
+//    if (getSquare(x1, y1)->getPieceColor() == turn)
+//    {
+//
+//
+//      if (makeMove(x1, y1, x2, y2) == false)
+//      {
+//        cout << "Invalid move, try again." << endl;
+//      }
+//      else
+//        stop = true;
+//    }
+//    else
+//      cout << "That's not your ChessPiece. Try again." << endl;
+//  }
+//  if (getSquare(x2, y2)->getPiece() == KING)
+//    if (getSquare(x1, y1)->getPieceColor() == PLAY_WHITE)
+//    {
+////      cout << "WHITE WINS" << endl;
+//      return false;
+//    }
+//    else
+//
+//    {
+////      cout << "BLACK WINS" << endl;
+//      return false;
+//    }
+//
+//
+//  if (turn == BLACK)
+//    turn = PLAY_WHITE;
+//  else
+//    turn = PLAY_BLACK;
+
+  return true;
+
+}
+
+void Board::setBoard() {
+  // Place the first row pieces in their position for both sides
+  const ChessPiece firstRow[8] = { ROOK, KNIGHT, BISHOP, QUEEN, KING, BISHOP, KNIGHT, ROOK };
+
+  // Start from an empty board
+  clearBoard();
+
+  for (int i = 0; i < 8; i++) {
+    putPiece(squareAt(i, 0), firstRow[i], PLAY_WHITE);
+    putPiece(squareAt(i, 7), firstRow[i], PLAY_BLACK);
+    // Place the Pawn rows
+    putPiece(squareAt(i, 1), PAWN, PLAY_WHITE);
+    putPiece(squareAt(i, 6), PAWN, PLAY_BLACK);
+  }
+
+  setState(CASTLE_WHITE_KING | CASTLE_WHITE_QUEEN | CASTLE_BLACK_KING | CASTLE_BLACK_QUEEN, NO_EN_PASSANT, 0, 1);
+  updateCheckInfo();
+}
+
+bool Board::setFen(const char* fen) {
+  //! FEN letters of the pieces, in ChessPiece order
+  const char* letters = "kqbnrp";
+  int x = 0;
+  int y = 7;
+
+  clearBoard();
+
+  // Pieces placement, from the 8th row down to the 1st
+  for (; *fen != '\0' && *fen != ' '; fen++) {
+    char c = *fen;
+    if (c == '/') {
+      x = 0;
+      y--;
+    }
+    else if (c >= '1' && c <= '8') {
+      x += c - '0';
+    }
+    else {
+      const char* letter = strchr(letters, (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c);
+      if (letter == NULL || x > 7 || y < 0) {
+        clearBoard();
+        return false;
+      }
+      putPiece(squareAt(x, y), (ChessPiece)(letter - letters), (c >= 'A' && c <= 'Z') ? PLAY_WHITE : PLAY_BLACK);
+      x++;
+    }
+  }
+
+  // Player in turn
+  while (*fen == ' ') {
+    fen++;
+  }
+  if (*fen == 'b') {
+    turn = PLAY_BLACK;
+    hash ^= ZOBRIST_SIDE;
+  }
+  if (*fen != '\0') {
+    fen++;
+  }
+
+  // Castling rights, "-" if none
+  int castling = 0;
+  while (*fen == ' ') {
+    fen++;
+  }
+  for (; *fen != '\0' && *fen != ' '; fen++) {
+    switch (*fen) {
+      case 'K': castling |= CASTLE_WHITE_KING; break;
+      case 'Q': castling |= CASTLE_WHITE_QUEEN; break;
+      case 'k': castling |= CASTLE_BLACK_KING; break;
+      case 'q': castling |= CASTLE_BLACK_QUEEN; break;
+      default: break;
+    }
+  }
+
+  // En passant square, "-" if none
+  int epFile = NO_EN_PASSANT;
+  while (*fen == ' ') {
+    fen++;
+  }
+  if (*fen >= 'a' && *fen <= 'h') {
+    epFile = *fen - 'a';
+  }
+  for (; *fen != '\0' && *fen != ' '; fen++);
+
+  // Move counters
+  int halfmoves = readFenNumber(fen, 0);
+  int fullmoves = readFenNumber(fen, 1);
+
+  setState(validCastling(castling), epFile, halfmoves, fullmoves > 0 ? fullmoves : 1);
+  updateCheckInfo();
+  return true;
+}
+
+int Board::getFen(char* text) const {
+  char* t = text;
+
+  // Pieces placement, from the 8th row down to the 1st
+  for (int y = 7; y >= 0; y--) {
+    int empty = 0;
+    for (int x = 0; x < 8; x++) {
+      PieceCode pc = mailbox[squareAt(x, y)];
+      if (pc == NO_PIECE) {
+        empty++;
+        continue;
+      }
+      if (empty > 0) {
+        *t++ = '0' + empty;
+        empty = 0;
+      }
+      *t++ = fenLetter(pc);
+    }
+    if (empty > 0) {
+      *t++ = '0' + empty;
+    }
+    if (y > 0) {
+      *t++ = '/';
+    }
+  }
+
+  // Player in turn and castling rights
+  int castling = stateCastling(state);
+  *t++ = ' ';
+  *t++ = (turn == PLAY_WHITE) ? 'w' : 'b';
+  *t++ = ' ';
+  if (castling == 0) {
+    *t++ = '-';
+  }
+  for (int i = 0; i < 4; i++) {
+    // The CASTLE_* bits are in the "KQkq" order
+    if (castling & (1 << i)) {
+      *t++ = "KQkq"[i];
+    }
+  }
+
+  // En passant square, behind the pawn just pushed
+  *t++ = ' ';
+  if (stateEpFile(state) == NO_EN_PASSANT) {
+    *t++ = '-';
+  }
+  else {
+    *t++ = 'a' + stateEpFile(state);
+    *t++ = (turn == PLAY_WHITE) ? '6' : '3';
+  }
+
+  t += snprintf(t, FEN_SIZE - (t - text), " %d %d", stateHalfmoves(state), stateFullmoves(state));
+  return t - text;
+}
+
+void Board::getPackedBoard(char* text) const {
+  for (int s = 0; s < BOARD_SQUARES; s++) {
+    text[s] = (mailbox[s] == NO_PIECE) ? '.' : fenLetter(mailbox[s]);
+  }
+  text[BOARD_SQUARES] = '\0';
+}
+
+bool Board::playGame()
+{
+//  system("cls");
+//  printBoard();
+//  return doMove();
+  return true;
+}
+
+
+int Board::moveKing(uint8_t from, uint8_t to) const {
+  // The king moves by one square in any direction
+  if (KING_ATTACKS[from] & squareMask(to)) {
+    return MOVE_OK;
+  }
+
+  // or by two squares along the row when castling
+  if (squareY(from) == squareY(to) && (from == to + 2 || to == from + 2)) {
+    return checkCastling(from, to);
+  }
+
+  return MOVE_KING_INVALID;
+}
+
+int Board::checkCastling(uint8_t from, uint8_t to) const {
+  //! The castling right used by the move
+  int right = (squareX(to) == 6) ? CASTLE_WHITE_KING : CASTLE_WHITE_QUEEN;
+  //! Row of the King and of the Rook
+  int row = (turn == PLAY_WHITE) ? 0 : 7;
+
+  if (turn == PLAY_BLACK) {
+    right <<= 2;
+  }
+
+  // The King and the Rook have not moved yet
+  if (from != squareAt(4, row) || !(stateCastling(state) & right)) {
+    return MOVE_KING_INVALID;
+  }
+
+  // The squares between the King and the Rook must be empty
+  if (squaresBetween(from, castlingRookFrom(to)) & occupied()) {
+    return MOVE_KING_INVALID;
+  }
+
+  // The King cannot castle out of check nor through an attacked square
+  if (checkers || (attackersTo(castlingRookTo(to), occupied()) & colors[turn ^ 1])) {
+    return MOVE_KING_IN_CHECK;
+  }
+
+  return MOVE_OK;
+}
+
+int Board::moveQueen(uint8_t from, uint8_t to) const { 
+  // The queen moves as a rook or as a bishop
+  if (!(queenAttacks(from, occupied()) & squareMask(to))) {
+    return MOVE_QUEEN_INVALID;
+  } // Wrong move
+
+  return MOVE_OK;
+}
+
+int Board::moveBishop(uint8_t from, uint8_t to) const {
+  // The bishop moves along the diagonals up to the first piece
+  if (!(bishopAttacks(from, occupied()) & squareMask(to))) {
+    return MOVE_BISHOP_INVALID;
+  } // Wrong move
+
+  return MOVE_OK;
+}
+
+int Board::moveKnight(uint8_t from, uint8_t to) const {
+  // Check for Knight valid moves
+  if (!(KNIGHT_ATTACKS[from] & squareMask(to))) {
+    return MOVE_KNIGHT_INVALID;
+  } // Wrong move
+
+  return MOVE_OK;
+}
+
+int Board::moveRook(uint8_t from, uint8_t to) const {
+  // The rook moves along rows and columns up to the first piece
+  if (!(rookAttacks(from, occupied()) & squareMask(to))) {
+    return MOVE_ROOK_INVALID;
+  } // Wrong move
+
+  return MOVE_OK;
+}
+
+int Board::movePawn(uint8_t from, uint8_t to) const {
+  ChessColor c = colorOn(from);
+  Bitboard toMask = squareMask(to);
+  Bitboard occupancy = occupied();
+  int ep = getEpSquare();
+  Bitboard epMask = (ep < 0) ? 0 : squareMask(ep);
+
+  // The pawn moves forward on an empty square or eats an opponent piece
+  // diagonally, also en passant. The tables already account for the direction
+  // of each color.
+  if ((PAWN_PUSHES[c][from] & toMask & ~occupancy) ||
+      (PAWN_ATTACKS[c][from] & toMask & (colors[c ^ 1] | epMask))) {
+    return MOVE_OK;
+  } // Correct move
+
+  // From its starting row the pawn can move forward by two empty squares
+  if (squareY(from) == (c == PLAY_WHITE ? 1 : 6) && squareX(from) == squareX(to) &&
+      (from == to + 16 || to == from + 16) && !(occupancy & (toMask | PAWN_PUSHES[c][from]))) {
+    return MOVE_OK;
+  }
+
+  return MOVE_PAWN_INVALID;
+}
+
+int Board::makeMove(int x1, int y1, int x2, int y2) {
+  // Validate from...to coordinates
+  if (x1 < 0 || x1 > 7 || y1 < 0 || y1 > 7 || x2 < 0 || x2 > 7 || y2 < 0 || y2 > 7) {
+    return MOVE_OUT_OF_BOUND;
+  }
+
+  //! The move between the two squares
+  Move m = buildMove(squareAt(x1, y1), squareAt(x2, y2), QUEEN);
+  //! Result of the validation, the board changes only for a legal move
+  int result = validate(m);
+
+  if (result == MOVE_OK) {
+    makeMove(m);
+  }
+
+  return result;
+}
+
+int Board::validate(Move m) const {
+  return validateMove(m, NULL);
+}
+
+void Board::validateBatch(const Move* moves, uint8_t* results, int count) const {
+  if (count <= 0) {
+    return;
+  }
+
+  // The King moves of the whole batch share the same attack map
+  Bitboard dangers = kingDangers();
+
+  for (int i = 0; i < count; i++) {
+    results[i] = (uint8_t)validateMove(moves[i], &dangers);
+  }
+}
+
+Move Board::buildMove(uint8_t from, uint8_t to, ChessPiece promotion) const {
+  ChessPiece p = pieceOn(from);
+
+  if (p == KING && squareY(from) == squareY(to) && (from == to + 2 || to == from + 2)) {
+    return packMove(from, to, MOVE_FLAG_CASTLING);
+  }
+  if (p == PAWN) {
+    if (squareY(to) == 0 || squareY(to) == 7) {
+      return packMove(from, to, MOVE_FLAG_PROMOTION, promotion);
+    }
+    if (to == getEpSquare() && squareX(from) != squareX(to)) {
+      return packMove(from, to, MOVE_FLAG_EN_PASSANT);
+    }
+  }
+  return packMove(from, to);
+}
+
+int Board::validateMove(Move m, const Bitboard* dangers) const {
+  //! Square index of the from coordinates
+  uint8_t from = moveFrom(m);
+  //! Square index of the dest coordinates
+  uint8_t to = moveTo(m);
+
+  // No more moves after checkmate or stalemate
+  if (isGameOver()) {
+    return MOVE_GAME_OVER;
+  }
+
+  // Check for a piece on the source coordinates
+  if (!(occupied() & squareMask(from))) {
+    return MOVE_SOURCE_EMPTY;
+  }
+
+  // Check if the piece belongs to the player in turn
+  if (!(colors[turn] & squareMask(from))) {
+    return MOVE_NOT_YOUR_TURN;
+  }
+
+  // Check if there is a piece of the same color on the destination coordinates
+  if (colors[turn] & squareMask(to)) {
+    return MOVE_SAME_COLOR_PIECE;
+  }
+
+  // The special move type must be the one of the position
+  if (m != buildMove(from, to, movePromotion(m))) {
+    return MOVE_GENERIC_ERROR;
+  }
+
+  //! Result of the validation of the piece rules
+  int result = MOVE_GENERIC_ERROR;
+
+  // Check for valid move accordingly to the game rules of the moved piece
+  // found on the source coordinates.
+  switch (pieceOn(from)) {
+    case KING: 
+      result = moveKing(from, to);
+      break;
+    case QUEEN: 
+      result = moveQueen(from, to);
+      break;
+    case BISHOP: 
+      result = moveBishop(from, to);
+      break;
+    case KNIGHT: 
+      result = moveKnight(from, to);
+      break;
+    case ROOK: 
+      result = moveRook(from, to);
+      break;
+    case PAWN: 
+      result = movePawn(from, to);
+      break;
+    default:
+      break;
+  }
+
+  if (result != MOVE_OK) {
+    return result;
+  }
+
+  // The piece rules are respected, the King must not be left under attack
+  if (dangers ? !leavesKingSafe(from, to, *dangers) : !leavesKingSafe(from, to)) {
+    return MOVE_KING_IN_CHECK;
+  }
+
+  return MOVE_OK;
+}
+
+void Board::makeMove(Move m) {
+  UndoInfo& undo = history[historyTop];
+  uint8_t from = moveFrom(m);
+  uint8_t to = moveTo(m);
+  int flags = moveFlags(m);
+  ChessPiece moved = pieceOn(from);
+  //! The captured pawn of an en passant capture is behind the destination
+  uint8_t captureSquare = (flags == MOVE_FLAG_EN_PASSANT) ? to ^ 8 : to;
+
+  // Save what the move destroys
+  undo.move = m;
+  undo.captured = mailbox[captureSquare];
+  undo.hash = hash;
+  undo.state = state;
+  historyTop = (historyTop + 1) % UNDO_STACK_SIZE;
+  if (historyCount < UNDO_STACK_SIZE) {
+    historyCount++;
+  }
+
+  if (flags == MOVE_FLAG_EN_PASSANT) {
+    putPiece(captureSquare, EMPTY, PLAY_NONE);
+  }
+  movePiece(from, to);
+  if (flags == MOVE_FLAG_PROMOTION) {
+    putPiece(to, movePromotion(m), turn);
+  }
+  else if (flags == MOVE_FLAG_CASTLING) {
+    movePiece(castlingRookFrom(to), castlingRookTo(to));
+  }
+
+  // New irreversible state: the rights are lost when the King or a Rook leave
+  // their squares or a Rook is captured, the clock restarts on captures and
+  // pawn moves, and a double push allows the en passant capture
+  int castling = stateCastling(state) & castlingKept(from) & castlingKept(to);
+  int epFile = (moved == PAWN && (from == to + 16 || to == from + 16)) ? squareX(from) : NO_EN_PASSANT;
+  int halfmoves = (moved == PAWN || undo.captured != NO_PIECE) ? 0 : stateHalfmoves(state) + 1;
+  int fullmoves = stateFullmoves(state) + (turn == PLAY_BLACK ? 1 : 0);
+
+  // The move has been done, it is the opponent turn
+  turn = (ChessColor)(turn ^ 1);
+  hash ^= ZOBRIST_SIDE;
+  setState(castling, epFile, halfmoves, fullmoves);
+  updateCheckInfo();
+}
+
+Move Board::parseMove(const char* text) {
+  MoveList list;
+  char legal[6];
+
+  generateMoves(list);
+  for (int i = 0; i < list.count; i++) {
+    moveToText(list.moves[i], legal);
+    if (strcmp(legal, text) == 0) {
+      return list.moves[i];
+    }
+  }
+  return MOVE_NONE;
+}
+
+bool Board::unmakeMove() {
+  if (historyCount == 0) {
+    return false;
+  }
+
+  historyTop = (historyTop + UNDO_STACK_SIZE - 1) % UNDO_STACK_SIZE;
+  historyCount--;
+  const UndoInfo& undo = history[historyTop];
+  uint8_t from = moveFrom(undo.move);
+  uint8_t to = moveTo(undo.move);
+  int flags = moveFlags(undo.move);
+  Bitboard fromMask = squareMask(from);
+  Bitboard toMask = squareMask(to);
+
+  turn = (ChessColor)(turn ^ 1);
+
+  // A promoted piece turns back into the pawn
+  if (flags == MOVE_FLAG_PROMOTION) {
+    scorePiece(mailbox[to], to, -1);
+    pieces[codePiece(mailbox[to])] ^= toMask;
+    pieces[PAWN] ^= toMask;
+    mailbox[to] = pieceCode(PAWN, turn);
+    scorePiece(mailbox[to], to, 1);
+  }
+
+  // Bring back the moved piece and the captured one
+  PieceCode moved = mailbox[to];
+  pieces[codePiece(moved)] ^= fromMask | toMask;
+  colors[turn] ^= fromMask | toMask;
+  mailbox[from] = moved;
+  mailbox[to] = NO_PIECE;
+  scorePiece(moved, to, -1);
+  scorePiece(moved, from, 1);
+
+  if (flags == MOVE_FLAG_CASTLING) {
+    uint8_t rookFrom = castlingRookFrom(to);
+    uint8_t rookTo = castlingRookTo(to);
+    Bitboard rookMask = squareMask(rookFrom) | squareMask(rookTo);
+    pieces[ROOK] ^= rookMask;
+    colors[turn] ^= rookMask;
+    mailbox[rookFrom] = mailbox[rookTo];
+    mailbox[rookTo] = NO_PIECE;
+    scorePiece(mailbox[rookFrom], rookTo, -1);
+    scorePiece(mailbox[rookFrom], rookFrom, 1);
+  }
+
+  if (undo.captured != NO_PIECE) {
+    uint8_t captureSquare = (flags == MOVE_FLAG_EN_PASSANT) ? to ^ 8 : to;
+    Bitboard captureMask = squareMask(captureSquare);
+    pieces[codePiece(undo.captured)] |= captureMask;
+    colors[turn ^ 1] |= captureMask;
+    mailbox[captureSquare] = undo.captured;
+    scorePiece(undo.captured, captureSquare, 1);
+  }
+  state = undo.state;
+  hash = undo.hash;
+  updateCheckInfo();
+
+  return true;
+}
+
+uint64_t Board::computeHash() const {
+  uint64_t h = (turn == PLAY_BLACK) ? ZOBRIST_SIDE : 0;
+  Bitboard b = occupied();
+
+  h ^= ZOBRIST_CASTLING[stateCastling(state)];
+  if (stateEpFile(state) != NO_EN_PASSANT) {
+    h ^= ZOBRIST_EN_PASSANT[stateEpFile(state)];
+  }
+
+  while (b) {
+    uint8_t s = popFirstSquare(b);
+    h ^= ZOBRIST_PIECES[codeColor(mailbox[s])][codePiece(mailbox[s])][s];
+  }
+  return h;
+}
+
+int Board::evaluate() const {
+  // The phase can exceed the start one after promotions
+  int mgWeight = (phase < PHASE_MAX) ? phase : PHASE_MAX;
+  int score = (scoreMg * mgWeight + scoreEg * (PHASE_MAX - mgWeight)) / PHASE_MAX;
+
+  return (turn == PLAY_WHITE) ? score : -score;
+}
+
+int Board::computeEvaluation() const {
+  int mg = 0;
+  int eg = 0;
+  int gamePhase = 0;
+  Bitboard b = occupied();
+
+  while (b) {
+    uint8_t s = popFirstSquare(b);
+    ChessColor c = codeColor(mailbox[s]);
+    ChessPiece p = codePiece(mailbox[s]);
+    mg += PIECE_SQUARE_MG[c][p][s];
+    eg += PIECE_SQUARE_EG[c][p][s];
+    gamePhase += PIECE_PHASE[p];
+  }
+
+  int mgWeight = (gamePhase < PHASE_MAX) ? gamePhase : PHASE_MAX;
+  int score = (mg * mgWeight + eg * (PHASE_MAX - mgWeight)) / PHASE_MAX;
+
+  return (turn == PLAY_WHITE) ? score : -score;
+}
+
+void Board::updateCheckInfo() {
+  Bitboard king = pieces[KING] & colors[turn];
+  Bitboard enemy = colors[turn ^ 1];
+  Bitboard occupancy = occupied();
+
+  checkers = 0;
+  pinned = 0;
+  status = -1;
+
+  if (!king) {
+    return;
+  }
+
+  uint8_t kingSquare = firstSquare(king);
+  checkers = attackersTo(kingSquare, occupancy) & enemy;
+
+  // Opponent sliders that would attack the King on an empty board
+  Bitboard snipers = ((rookAttacks(kingSquare, 0) & (pieces[ROOK] | pieces[QUEEN])) |
+                      (bishopAttacks(kingSquare, 0) & (pieces[BISHOP] | pieces[QUEEN]))) & enemy;
+
+  // A single own piece between the King and a sniper is pinned
+  while (snipers) {
+    Bitboard between = squaresBetween(kingSquare, popFirstSquare(snipers)) & occupancy;
+    if (between && !(between & (between - 1)) && (between & colors[turn])) {
+      pinned |= between;
+    }
+  }
+}
+
+bool Board::hasLegalMove() const {
+  MoveList list;
+
+  generatePseudoLegalMoves(list);
+  for (int i = 0; i < list.count; i++) {
+    if (leavesKingSafe(moveFrom(list.moves[i]), moveTo(list.moves[i]))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int Board::gameStatus() const {
+  if (status < 0) {
+    if (hasLegalMove()) {
+      status = checkers ? GAME_CHECK : GAME_PLAYING;
+    }
+    else {
+      status = checkers ? GAME_CHECKMATE : GAME_STALEMATE;
+    }
+  }
+  return status;
+}
+
+Bitboard Board::targets[BOARD_SQUARES];
+uint64_t Board::targetsHash = 0;
+bool Board::targetsReady = false;
+
+Bitboard Board::legalTargets(uint8_t s) const {
+  // The hash tells the positions apart, and the legal moves do not depend on the move counters
+  if (!targetsReady || targetsHash != hash) {
+    MoveList list;
+
+    generateMoves(list);
+    for (int i = 0; i < BOARD_SQUARES; i++) {
+      targets[i] = 0;
+    }
+    for (int i = 0; i < list.count; i++) {
+      targets[moveFrom(list.moves[i])] |= squareMask(moveTo(list.moves[i]));
+    }
+    targetsHash = hash;
+    targetsReady = true;
+  }
+  return targets[s];
+}
+
+Bitboard Board::attackersTo(uint8_t s, Bitboard occupancy) const {
+  return (PAWN_ATTACKS[PLAY_WHITE][s] & pieces[PAWN] & colors[PLAY_BLACK]) |
+         (PAWN_ATTACKS[PLAY_BLACK][s] & pieces[PAWN] & colors[PLAY_WHITE]) |
+         (KNIGHT_ATTACKS[s] & pieces[KNIGHT]) |
+         (KING_ATTACKS[s] & pieces[KING]) |
+         (bishopAttacks(s, occupancy) & (pieces[BISHOP] | pieces[QUEEN])) |
+         (rookAttacks(s, occupancy) & (pieces[ROOK] | pieces[QUEEN]));
+}
+
+void Board::addMoves(MoveList& list, uint8_t from, Bitboard targets) const {
+  while (targets) {
+    list.add(packMove(from, popFirstSquare(targets)));
+  }
+}
+
+void Board::addPawnMoves(MoveList& list, uint8_t from, Bitboard targets) const {
+  int ep = getEpSquare();
+
+  while (targets) {
+    uint8_t to = popFirstSquare(targets);
+    if (squareY(to) == 0 || squareY(to) == 7) {
+      for (int p = QUEEN; p <= ROOK; p++) {
+        list.add(packMove(from, to, MOVE_FLAG_PROMOTION, (ChessPiece)p));
+      }
+    }
+    else {
+      list.add(packMove(from, to, (to == ep) ? MOVE_FLAG_EN_PASSANT : MOVE_FLAG_NORMAL));
+    }
+  }
+}
+
+void Board::generatePseudoLegalMoves(MoveList& list, Bitboard targets) const {
+  Bitboard own = colors[turn];
+  Bitboard enemy = colors[turn ^ 1];
+  Bitboard occupancy = own | enemy;
+  Bitboard b;
+
+  list.count = 0;
+
+  // The en passant capture is kept when the square of the captured pawn is a target
+  int ep = getEpSquare();
+  Bitboard epMask = (ep < 0 || !(targets & squareMask(ep ^ 8))) ? 0 : squareMask(ep);
+  int startRow = (turn == PLAY_WHITE) ? 1 : 6;
+
+  // Pawns push on empty squares, by two from their starting row, and capture
+  // only the opponent pieces, also en passant
+  b = pieces[PAWN] & own;
+  while (b) {
+    uint8_t from = popFirstSquare(b);
+    Bitboard pushes = PAWN_PUSHES[turn][from] & ~occupancy;
+    if (pushes && squareY(from) == startRow) {
+      pushes |= PAWN_PUSHES[turn][firstSquare(pushes)] & ~occupancy;
+    }
+    addPawnMoves(list, from, (pushes & targets) | (PAWN_ATTACKS[turn][from] & ((enemy & targets) | epMask)));
+  }
+
+  // All the other pieces land on empty or opponent squares
+  targets &= ~own;
+  b = pieces[KNIGHT] & own;
+  while (b) {
+    uint8_t from = popFirstSquare(b);
+    addMoves(list, from, KNIGHT_ATTACKS[from] & targets);
+  }
+
+  b = pieces[BISHOP] & own;
+  while (b) {
+    uint8_t from = popFirstSquare(b);
+    addMoves(list, from, bishopAttacks(from, occupancy) & targets);
+  }
+
+  b = pieces[ROOK] & own;
+  while (b) {
+    uint8_t from = popFirstSquare(b);
+    addMoves(list, from, rookAttacks(from, occupancy) & targets);
+  }
+
+  b = pieces[QUEEN] & own;
+  while (b) {
+    uint8_t from = popFirstSquare(b);
+    addMoves(list, from, queenAttacks(from, occupancy) & targets);
+  }
+
+  b = pieces[KING] & own;
+  while (b) {
+    uint8_t from = popFirstSquare(b);
+    addMoves(list, from, KING_ATTACKS[from] & targets);
+  }
+
+  // Castling, the King destination is checked with the other King moves
+  if (stateCastling(state) & (turn == PLAY_WHITE ? 3 : 12)) {
+    uint8_t from = squareAt(4, startRow == 1 ? 0 : 7);
+    if ((targets & squareMask(from + 2)) && checkCastling(from, from + 2) == MOVE_OK) {
+      list.add(packMove(from, from + 2, MOVE_FLAG_CASTLING));
+    }
+    if ((targets & squareMask(from - 2)) && checkCastling(from, from - 2) == MOVE_OK) {
+      list.add(packMove(from, from - 2, MOVE_FLAG_CASTLING));
+    }
+  }
+}
+
+bool Board::leavesKingSafe(uint8_t from, uint8_t to) const {
+  Bitboard king = pieces[KING] & colors[turn];
+  Bitboard fromMask = squareMask(from);
+  Bitboard toMask = squareMask(to);
+
+  // Without a king on the board there is nothing to protect
+  if (!king) {
+    return true;
+  }
+
+  if (!(king & fromMask)) {
+    uint8_t kingSquare = firstSquare(king);
+
+    // An en passant capture empties two squares: check the lines through both
+    if (pieceOn(from) == PAWN && to == getEpSquare() && squareX(from) != squareX(to)) {
+      Bitboard capturedMask = squareMask(to ^ 8);
+      Bitboard occupancy = (occupied() ^ fromMask ^ capturedMask) | toMask;
+      return !(attackersTo(kingSquare, occupancy) & colors[turn ^ 1] & ~capturedMask);
+    }
+
+    // Against a single check a piece must capture the checker or block its line.
+    // A pinned piece can never do it, and only the King can escape a double check.
+    if (checkers) {
+      if ((checkers & (checkers - 1)) || (pinned & fromMask)) {
+        return false;
+      }
+      return (toMask & (checkers | squaresBetween(kingSquare, firstSquare(checkers)))) != 0;
+    }
+
+    // Only the pinned pieces can expose the King when not in check, and they
+    // can still move along the line between the King and the pinner.
+    if (!(pinned & fromMask)) {
+      return true;
+    }
+    return (squaresBetween(kingSquare, from) & toMask) || (squaresBetween(kingSquare, to) & fromMask);
+  }
+
+  // The King leaves its square, so it does not stop the sliders anymore.
+  // A captured opponent piece does not attack anymore.
+  return !(attackersTo(to, occupied() & ~fromMask) & colors[turn ^ 1] & ~toMask);
+}
+
+bool Board::leavesKingSafe(uint8_t from, uint8_t to, Bitboard dangers) const {
+  if (pieces[KING] & colors[turn] & squareMask(from)) {
+    return !(dangers & squareMask(to));
+  }
+  return leavesKingSafe(from, to);
+}
+
+Bitboard Board::kingDangers() const {
+  ChessColor opponent = (ChessColor)(turn ^ 1);
+  Bitboard enemy = colors[opponent];
+  Bitboard occupancy = occupied() & ~(pieces[KING] & colors[turn]);
+  Bitboard dangers = 0;
+  Bitboard b;
+
+  b = pieces[PAWN] & enemy;
+  while (b) {
+    dangers |= PAWN_ATTACKS[opponent][popFirstSquare(b)];
+  }
+
+  b = pieces[KNIGHT] & enemy;
+  while (b) {
+    dangers |= KNIGHT_ATTACKS[popFirstSquare(b)];
+  }
+
+  b = (pieces[BISHOP] | pieces[QUEEN]) & enemy;
+  while (b) {
+    dangers |= bishopAttacks(popFirstSquare(b), occupancy);
+  }
+
+  b = (pieces[ROOK] | pieces[QUEEN]) & enemy;
+  while (b) {
+    dangers |= rookAttacks(popFirstSquare(b), occupancy);
+  }
+
+  b = pieces[KING] & enemy;
+  while (b) {
+    dangers |= KING_ATTACKS[popFirstSquare(b)];
+  }
+
+  return dangers;
+}
+
+void Board::generateMoves(MoveList& list, Bitboard targets) const {
+  Bitboard dangers = kingDangers();
+  int legal = 0;
+
+  // Keep only the pseudo legal moves not exposing the king
+  generatePseudoLegalMoves(list, targets);
+  for (int i = 0; i < list.count; i++) {
+    if (leavesKingSafe(moveFrom(list.moves[i]), moveTo(list.moves[i]), dangers)) {
+      list.moves[legal++] = list.moves[i];
+    }
+  }
+  list.count = legal;
+}
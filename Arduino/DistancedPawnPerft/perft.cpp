@@ -0,0 +1,185 @@
+/**
+ * @file perft.cpp
+ * @brief Perft counters and reference suite
+ */
+
+#include "perft.h"
+
+const PerftPosition PERFT_SUITE[] = {
+  { "Start position",
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    { 20, 400, 8902, 197281, 4865609, 119060324ULL } },
+  { "Kiwipete",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    { 48, 2039, 97862, 4085603, 193690690ULL, 0 } },
+  { "Rook endgame",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    { 14, 191, 2812, 43238, 674624, 11030083ULL } },
+  { "Promotions",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    { 6, 264, 9467, 422333, 15833292ULL, 0 } },
+  { "Discovered checks",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    { 44, 1486, 62379, 2103487, 89941194ULL, 0 } },
+  { "Middlegame",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+    { 46, 2079, 89890, 3894594, 164075551ULL, 0 } }
+};
+
+const int PERFT_SUITE_SIZE = sizeof(PERFT_SUITE) / sizeof(PERFT_SUITE[0]);
+
+/**
+ * Print a 64-bit counter. The Print class of the Arduino core
+ * does not support 64-bit integers on every board.
+ */
+static void printCount(Print* out, uint64_t n) {
+  char text[21];
+  int i = sizeof(text) - 1;
+
+  text[i] = '\0';
+  do {
+    text[--i] = '0' + (char)(n % 10);
+    n /= 10;
+  } while (n);
+  *out << &text[i];
+}
+
+uint64_t perft(Board& board, int depth) {
+  MoveList list;
+  uint64_t nodes = 0;
+
+  board.generateMoves(list);
+
+  // The last level is counted without making the moves
+  if (depth <= 1) {
+    return (depth == 1) ? list.count : 1;
+  }
+
+  for (int i = 0; i < list.count; i++) {
+    board.makeMove(list.moves[i]);
+    nodes += perft(board, depth - 1);
+    board.unmakeMove();
+  }
+  return nodes;
+}
+
+uint64_t perftDivide(Board& board, int depth, Print* out) {
+  MoveList list;
+  uint64_t total = 0;
+  char text[6];
+
+  board.generateMoves(list);
+  for (int i = 0; i < list.count; i++) {
+    board.makeMove(list.moves[i]);
+    uint64_t nodes = perft(board, depth - 1);
+    board.unmakeMove();
+
+    moveToText(list.moves[i], text);
+    *out << text << ": ";
+    printCount(out, nodes);
+    *out << endl;
+    total += nodes;
+  }
+  *out << "Total: ";
+  printCount(out, total);
+  *out << endl;
+  return total;
+}
+
+uint32_t perftVerify(Board& board, int depth) {
+  MoveList list;
+  uint32_t errors = 0;
+
+  if (board.getHash() != board.computeHash() || board.evaluate() != board.computeEvaluation()) {
+    errors++;
+  }
+
+  // The FEN written and read back is the same position
+  char fen[FEN_SIZE];
+  Board copy;
+  board.getFen(fen);
+  if (!copy.setFen(fen) || copy.getHash() != board.getHash() || copy.getState() != board.getState()) {
+    errors++;
+  }
+  if (depth == 0) {
+    return errors;
+  }
+
+  board.generateMoves(list);
+
+  // The captures and promotions alone are the moves of the full list landing
+  // on their targets, the en passant captures included, in the same order
+  MoveList noisy;
+  Bitboard targets = board.noisyTargets();
+  int n = 0;
+  board.generateMoves(noisy, targets);
+  for (int i = 0; i < list.count; i++) {
+    Move m = list.moves[i];
+    if ((targets & squareMask(moveTo(m))) || moveFlags(m) == MOVE_FLAG_EN_PASSANT) {
+      if (n >= noisy.count || noisy.moves[n] != m) {
+        errors++;
+      }
+      n++;
+    }
+  }
+  if (n != noisy.count) {
+    errors++;
+  }
+
+  for (int i = 0; i < list.count; i++) {
+    uint64_t hash = board.getHash();
+    board.makeMove(list.moves[i]);
+    errors += perftVerify(board, depth - 1);
+    board.unmakeMove();
+    if (board.getHash() != hash) {
+      errors++;
+    }
+  }
+  return errors;
+}
+
+int runPerftSuite(Print* out, int maxDepth, bool verify) {
+  Board board;
+  int failures = 0;
+
+  for (int p = 0; p < PERFT_SUITE_SIZE; p++) {
+    const PerftPosition& position = PERFT_SUITE[p];
+    *out << position.name << endl;
+    board.setFen(position.fen);
+
+    for (int depth = 1; depth <= maxDepth && depth <= PERFT_MAX_DEPTH; depth++) {
+      uint64_t expected = position.nodes[depth - 1];
+      if (expected == 0) {
+        break;
+      }
+
+      unsigned long start = millis();
+      uint64_t nodes = perft(board, depth);
+      unsigned long elapsed = millis() - start;
+
+      *out << "  depth " << depth << ": ";
+      printCount(out, nodes);
+      *out << " nodes, " << elapsed << " ms, ";
+      printCount(out, elapsed ? nodes * 1000 / elapsed : 0);
+      *out << " nps";
+      if (nodes == expected) {
+        *out << " ok" << endl;
+      }
+      else {
+        *out << " FAILED, expected ";
+        printCount(out, expected);
+        *out << endl;
+        failures++;
+      }
+    }
+
+    if (verify) {
+      uint32_t errors = perftVerify(board, maxDepth < 4 ? maxDepth : 4);
+      *out << "  consistency: " << (errors ? "FAILED" : "ok") << endl;
+      if (errors) {
+        failures++;
+      }
+    }
+  }
+  return failures;
+}
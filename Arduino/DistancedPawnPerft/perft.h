@@ -0,0 +1,79 @@
+/**
+ * @file perft.h
+ * @brief Move generator performance and correctness test (perft)
+ *
+ * Perft counts the leaf nodes of the legal moves tree of a position up to a
+ * fixed depth. The counts of the reference positions are known, so any
+ * difference points to a bug of the move generator or of make/unmake, while
+ * the time spent gives the speed of the engine core.
+ */
+
+#ifndef _PERFT
+#define _PERFT
+
+#include "chess_moves.h"
+
+//! Deepest depth with a reference count in the suite
+#define PERFT_MAX_DEPTH 6
+
+//! A reference position with the known node counts
+struct PerftPosition {
+  const char* name;                     //!< Short description
+  const char* fen;                      //!< The position in FEN
+  uint64_t nodes[PERFT_MAX_DEPTH];      //!< Node counts from depth 1, 0 when not listed
+};
+
+//! The standard perft positions
+extern const PerftPosition PERFT_SUITE[];
+
+//! Number of positions of PERFT_SUITE
+extern const int PERFT_SUITE_SIZE;
+
+/**
+ * Count the leaf nodes of the legal moves tree
+ *
+ * @param board The position, unchanged on return
+ * @param depth The depth of the tree
+ *
+ * @return The number of leaf nodes
+ */
+uint64_t perft(Board& board, int depth);
+
+/**
+ * Count the leaf nodes printing the count under every root move
+ *
+ * @param board The position, unchanged on return
+ * @param depth The depth of the tree
+ * @param out Where the counts are printed
+ *
+ * @return The number of leaf nodes
+ */
+uint64_t perftDivide(Board& board, int depth, Print* out);
+
+/**
+ * Walk the legal moves tree checking the board consistency at every node:
+ * the incremental hash and evaluation must match the ones calculated from
+ * scratch, the FEN of the position must read back to the same position, the
+ * moves generated for the noisyTargets() alone must be the ones of the full
+ * list and every unmakeMove() must restore the previous hash.
+ *
+ * @param board The position, unchanged on return
+ * @param depth The depth of the tree
+ *
+ * @return The number of inconsistencies found
+ */
+uint32_t perftVerify(Board& board, int depth);
+
+/**
+ * Run the reference suite, printing the counts, the speed and the outcome
+ * of every position
+ *
+ * @param out Where the results are printed
+ * @param maxDepth The deepest depth to run for every position
+ * @param verify If true also run perftVerify() on every position
+ *
+ * @return The number of failed checks
+ */
+int runPerftSuite(Print* out, int maxDepth, bool verify);
+
+#endif
@@ -0,0 +1,37 @@
+/**
+ * @file zobrist.cpp
+ * @brief Compile-time generation of the Zobrist keys
+ */
+
+#include "zobrist.h"
+
+//! Expand 8 consecutive keys starting from the sequence index n
+#define ZOBRIST_ROW(n) \
+  zobristKey(n + 0), zobristKey(n + 1), zobristKey(n + 2), zobristKey(n + 3), \
+  zobristKey(n + 4), zobristKey(n + 5), zobristKey(n + 6), zobristKey(n + 7)
+
+//! Expand the 64 keys of a piece, starting from the sequence index n
+#define ZOBRIST_BOARD(n) { \
+  ZOBRIST_ROW(n + 0), ZOBRIST_ROW(n + 8), ZOBRIST_ROW(n + 16), ZOBRIST_ROW(n + 24), \
+  ZOBRIST_ROW(n + 32), ZOBRIST_ROW(n + 40), ZOBRIST_ROW(n + 48), ZOBRIST_ROW(n + 56) }
+
+// First values of the reference SplitMix64 sequence seeded with 0
+static_assert(zobristKey(0) == 0xE220A8397B1DCDAFULL, "Wrong Zobrist key generator");
+static_assert(zobristKey(1) == 0x6E789E6AA1B965F4ULL, "Wrong Zobrist key generator");
+
+constexpr uint64_t ZOBRIST_PIECES[2][6][BOARD_SQUARES] = {
+  { ZOBRIST_BOARD(0), ZOBRIST_BOARD(64), ZOBRIST_BOARD(128),
+    ZOBRIST_BOARD(192), ZOBRIST_BOARD(256), ZOBRIST_BOARD(320) },
+  { ZOBRIST_BOARD(384), ZOBRIST_BOARD(448), ZOBRIST_BOARD(512),
+    ZOBRIST_BOARD(576), ZOBRIST_BOARD(640), ZOBRIST_BOARD(704) }
+};
+
+constexpr uint64_t ZOBRIST_SIDE = zobristKey(768);
+
+// No castling rights add no key, so a position without them keeps the same hash
+constexpr uint64_t ZOBRIST_CASTLING[16] = {
+  0, ZOBRIST_ROW(769), zobristKey(777), zobristKey(778), zobristKey(779),
+  zobristKey(780), zobristKey(781), zobristKey(782), zobristKey(783)
+};
+
+constexpr uint64_t ZOBRIST_EN_PASSANT[8] = { ZOBRIST_ROW(784) };
@@ -0,0 +1,53 @@
+/**
+ * @file zobrist.h
+ * @brief Random keys of the Zobrist hashing of the board positions
+ *
+ * The hash of a position is the XOR of one key for every piece on its square,
+ * of the side key when black is in turn, of the key of the castling rights and
+ * of the key of the en passant file, if any, so a move updates it with a few
+ * XORs. The keys are generated at compile time with the SplitMix64 sequence and
+ * stored as constant data (flash on the MKR1010).
+ */
+
+#ifndef _ZOBRIST
+#define _ZOBRIST
+
+#include <stdint.h>
+
+#include "bitboard.h"
+
+//! SplitMix64 output mixing function
+constexpr uint64_t zobristMix(uint64_t z) {
+  return z ^ (z >> 31);
+}
+
+//! Second SplitMix64 mixing round
+constexpr uint64_t zobristMix2(uint64_t z) {
+  return zobristMix((z ^ (z >> 27)) * 0x94D049BB133111EBULL);
+}
+
+/**
+ * The n-th key of the SplitMix64 sequence
+ *
+ * @param n Index of the key
+ *
+ * @return The 64-bit random key
+ */
+constexpr uint64_t zobristKey(int n) {
+  return zobristMix2(((0x9E3779B97F4A7C15ULL * (uint64_t)(n + 1)) ^
+                      ((0x9E3779B97F4A7C15ULL * (uint64_t)(n + 1)) >> 30)) * 0xBF58476D1CE4E5B9ULL);
+}
+
+//! Keys of every piece of every color on every square, indexed by color, piece and square
+extern const uint64_t ZOBRIST_PIECES[2][6][BOARD_SQUARES];
+
+//! Key added when black is in turn
+extern const uint64_t ZOBRIST_SIDE;
+
+//! Keys of every combination of the castling rights, indexed by the CASTLE_* bits
+extern const uint64_t ZOBRIST_CASTLING[16];
+
+//! Keys of the file of the pawn that can be captured en passant
+extern const uint64_t ZOBRIST_EN_PASSANT[8];
+
+#endif
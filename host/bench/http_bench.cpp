@@ -0,0 +1,421 @@
+/**
+ * @file http_bench.cpp
+ * @brief Requests per second of the web server request parser
+ *
+ * Usage:
+ *
+ *     http_bench [requests]           parse and route the requests (default 2000000)
+ *     http_bench --check parser       check the parsing and the routing of the requests
+ *     http_bench --check keep-alive   check the persistent connections
+ *
+ * A set of requests as sent by browsers and by the remote board are parsed
+ * byte by byte, and in blocks of HTTP_READ_BLOCK bytes of a persistent
+ * connection as the sketches read the WiFi client, and routed to handlers
+ * that answer to a sink. The same requests are also read by the String line
+ * loop the sketches used before, for comparison. The heap allocations of all
+ * the runs are counted: the parser must not allocate.
+ *
+ * The checks print the outcome of every check; the exit code is the number
+ * of failed checks.
+ */
+
+#include <chrono>
+#include <new>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "http_parser.h"
+#include "server_params.h"
+
+//! Heap allocations of the program
+static unsigned long allocations = 0;
+
+void* operator new(size_t size) {
+  allocations++;
+  void* p = malloc(size ? size : 1);
+  if (p == NULL) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+//! Output discarding the answers, counting the bytes
+class SinkPrint : public Print {
+public:
+  unsigned long bytes = 0;
+  size_t write(uint8_t) { bytes++; return 1; }
+  using Print::write;
+};
+
+//! Requests of the bench: remote board polling and moving, a browser, errors
+static const char* REQUESTS[] = {
+  "GET /S HTTP/1.1\r\nHost: 10.0.0.1:8080\r\n\r\n",
+  "GET /M?e2e4 HTTP/1.1\r\nHost: 10.0.0.1:8080\r\nUser-Agent: DistancedPawn\r\n\r\n",
+  "GET /S?t=e2 HTTP/1.1\r\nHost: 10.0.0.1:8080\r\n\r\n",
+  "GET /N HTTP/1.1\r\nHost: 10.0.0.1:8080\r\nConnection: close\r\n\r\n",
+  "GET /S HTTP/1.1\r\nHost: 10.0.0.1:8080\r\nUser-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:109.0) "
+    "Gecko/20100101 Firefox/115.0\r\nAccept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+    "Accept-Language: en-US,en;q=0.5\r\nAccept-Encoding: gzip, deflate\r\nConnection: keep-alive\r\n\r\n",
+  "GET /favicon.ico HTTP/1.1\r\nHost: 10.0.0.1:8080\r\n\r\n",
+  "POST /M HTTP/1.1\r\nHost: 10.0.0.1:8080\r\n\r\n"
+};
+
+//! Number of bench requests
+#define REQUESTS_COUNT (int)(sizeof(REQUESTS) / sizeof(REQUESTS[0]))
+
+//! Handler answering a fixed text, as long as the sketch answers
+static void handleFixed(Print& out, HttpParser& request) {
+  request.respond(out, 200, (request.query()[0] != '\0') ? "00 00002 b 0" :
+              "00001 w 0 RNBQKBNRPPPPPPPP................................pppppppprnbqkbnr");
+}
+
+//! Routes of the sketch
+static const HttpRoute ROUTES[] = {
+  { HTTPGET_NEWGAME, handleFixed },
+  { HTTPGET_MOVE, handleFixed },
+  { HTTPGET_STATUS, handleFixed }
+};
+
+//! Read the requests with the parser and route them
+static void runParser(long count, SinkPrint& sink) {
+  static HttpParser parser;
+
+  for (long i = 0; i < count; i++) {
+    const char* request = REQUESTS[i % REQUESTS_COUNT];
+    parser.begin();
+    for (const char* c = request; *c; c++) {
+      if (parser.feed(*c) != HTTP_PARSE_MORE) {
+        parser.dispatch(sink, ROUTES, 3);
+        break;
+      }
+    }
+  }
+}
+
+//! Read the requests sent back to back on persistent connections in blocks, as the sketches do
+static void runParserBlocks(long count, SinkPrint& sink) {
+  static HttpParser parser;
+  static char stream[4096];
+  int size = 0;
+
+  for (int i = 0; i < REQUESTS_COUNT; i++) {
+    strcpy(stream + size, REQUESTS[i]);
+    size += (int)strlen(REQUESTS[i]);
+  }
+
+  // A new connection starts after the answers with "Connection: close"
+  long served = 0;
+  parser.begin();
+  while (served < count) {
+    for (int block = 0; block < size && served < count; block += HTTP_READ_BLOCK) {
+      int end = (size - block < HTTP_READ_BLOCK) ? size : block + HTTP_READ_BLOCK;
+      int start = block;
+      int used;
+      while (start < end && parser.feed(stream + start, end - start, used) != HTTP_PARSE_MORE) {
+        bool open = parser.keepAlive();
+        start += used;
+        parser.dispatch(sink, ROUTES, 3);
+        served++;
+        if (open) {
+          parser.reset();
+        }
+        else {
+          parser.begin();
+        }
+      }
+    }
+  }
+}
+
+//! Read the requests with the String line loop of the previous sketches
+static void runStringLoop(long count, SinkPrint& sink) {
+  for (long i = 0; i < count; i++) {
+    const char* request = REQUESTS[i % REQUESTS_COUNT];
+    String currentLine = "";
+    for (const char* c = request; *c; c++) {
+      if (*c == '\n') {
+        if (currentLine.length() == 0) {
+          httpRespond(sink, 200, "w", false);
+          break;
+        }
+        currentLine = "";
+      }
+      else if (*c != '\r') {
+        currentLine += *c;
+      }
+    }
+  }
+}
+
+//! Time a run and print its requests per second and allocations
+static void measure(const char* name, void (*run)(long, SinkPrint&), long count) {
+  SinkPrint sink;
+  unsigned long before = allocations;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  run(count, sink);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("%-14s %10.0f requests/s  %8.1f ns/request  %.2f allocations/request  %lu bytes answered\n",
+         name, count / seconds, seconds * 1e9 / count, (double)(allocations - before) / count, sink.bytes);
+}
+
+// =========================================================
+//                         Checks
+// =========================================================
+
+//! Output keeping the answers
+class TextPrint : public Print {
+public:
+  std::string text;
+  size_t write(uint8_t c) { text += (char)c; return 1; }
+  using Print::write;
+};
+
+//! What the parser found in a request
+struct ParseOutcome {
+  int result;
+  int used;
+  int error;
+  bool keepAlive;
+  std::string path;
+  std::string query;
+
+  bool operator==(const ParseOutcome& o) const {
+    return result == o.result && used == o.used && error == o.error && keepAlive == o.keepAlive &&
+           path == o.path && query == o.query;
+  }
+};
+
+//! Failed checks
+static int failures = 0;
+
+//! Print the outcome of a check
+static void check(const char* name, bool ok) {
+  printf("%s: %s\n", name, ok ? "ok" : "FAILED");
+  failures += ok ? 0 : 1;
+}
+
+//! Handler answering the query
+static void handleEcho(Print& out, HttpParser& request) {
+  request.respond(out, 200, request.query());
+}
+
+//! Routes of the checks
+static const HttpRoute CHECK_ROUTES[] = {
+  { HTTPGET_MOVE, handleEcho },
+  { HTTPGET_STATUS, handleEcho }
+};
+
+//! Outcome of the parser after the request
+static ParseOutcome outcome(const HttpParser& parser, int result, int used) {
+  ParseOutcome o = { result, used, parser.error(), parser.keepAlive(), "", "" };
+
+  if (result != HTTP_PARSE_MORE) {
+    o.path = parser.path();
+    o.query = parser.query();
+  }
+  return o;
+}
+
+//! Parse a request byte by byte
+static ParseOutcome parseBytes(HttpParser& parser, const char* request) {
+  int result = HTTP_PARSE_MORE;
+  int used = 0;
+
+  while (request[used] != '\0' && result == HTTP_PARSE_MORE) {
+    result = parser.feed(request[used++]);
+  }
+  return outcome(parser, result, used);
+}
+
+//! Parse a request in two blocks, the first one of split bytes
+static ParseOutcome parseSplit(HttpParser& parser, const char* request, int split) {
+  int size = (int)strlen(request);
+  int used;
+  int result = parser.feed(request, split, used);
+
+  if (result == HTTP_PARSE_MORE) {
+    int rest;
+    result = parser.feed(request + split, size - split, rest);
+    used += rest;
+  }
+  return outcome(parser, result, used);
+}
+
+//! Parse a request and route it, returning the answer
+static std::string answer(const char* request) {
+  HttpParser parser;
+  TextPrint out;
+
+  if (parseBytes(parser, request).result != HTTP_PARSE_MORE) {
+    parser.dispatch(out, CHECK_ROUTES, 2);
+  }
+  return out.text;
+}
+
+//! The answer has the status
+static bool hasStatus(const std::string& text, int status) {
+  char head[16];
+  snprintf(head, sizeof(head), "HTTP/1.1 %d ", status);
+  return text.compare(0, strlen(head), head) == 0;
+}
+
+//! Whether the connection stays open after the request
+static bool keepsAlive(const char* request) {
+  HttpParser parser;
+  return parseBytes(parser, request).keepAlive;
+}
+
+//! Requests of the checks, besides the ones of the bench
+static const char* CHECK_REQUESTS[] = {
+  "GET /S?a?b HTTP/1.1\r\n\r\n",
+  "GET /S HTTP/1.0\r\nHost: 10.0.0.1\r\n\r\n",
+  "GET /S HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n",
+  "GET /S HTTP/1.1\r\nCache-Control: no-cache\r\nconnection:close\r\nHost: 10.0.0.1\r\n\r\n",
+  "GET /S HTTP/1.1\r\nUser-Agent: Xconnection: close\r\n\r\n",
+  "GET /S HTTP/1.1\r\nConnectionX: close\r\n\r\n",
+  "\r\nGET /M?e2e4 HTTP/1.1\r\n\r\nGET /S HTTP/1.1\r\n\r\n",
+  "GET /S\r\n\r\n",
+  "GET /0123456789012345678901234567890123456789012345678901234 HTTP/1.1\r\n\r\n"
+};
+
+//! Number of check requests
+#define CHECK_REQUESTS_COUNT (int)(sizeof(CHECK_REQUESTS) / sizeof(CHECK_REQUESTS[0]))
+
+//! Check the parsing and the routing of the requests
+static void checkParser() {
+  HttpParser parser;
+
+  parseBytes(parser, "GET /M?e2e4 HTTP/1.1\r\nHost: 10.0.0.1\r\n\r\n");
+  bool ok = strcmp(parser.path(), "/M") == 0 && strcmp(parser.query(), "e2e4") == 0;
+  parser.begin();
+  parseBytes(parser, "GET /S HTTP/1.1\r\n\r\n");
+  ok = ok && strcmp(parser.path(), "/S") == 0 && strcmp(parser.query(), "") == 0;
+  parser.begin();
+  parseBytes(parser, CHECK_REQUESTS[0]);
+  check("Path and query", ok && strcmp(parser.path(), "/S") == 0 && strcmp(parser.query(), "a?b") == 0);
+
+  check("Route", answer("GET /M?e2e4 HTTP/1.1\r\n\r\n").find("\r\n\r\ne2e4") != std::string::npos);
+  check("400 answer", hasStatus(answer("GET /S\r\n\r\n"), 400) && hasStatus(answer("GET\r\n\r\n"), 400));
+  check("404 answer", hasStatus(answer("GET /favicon.ico HTTP/1.1\r\n\r\n"), 404));
+  check("405 answer", hasStatus(answer("POST /M HTTP/1.1\r\n\r\n"), 405) &&
+                      hasStatus(answer("GETS /M HTTP/1.1\r\n\r\n"), 405));
+  check("414 answer", hasStatus(answer(CHECK_REQUESTS[CHECK_REQUESTS_COUNT - 1]), 414));
+
+  check("HTTP/1.1 keeps alive", keepsAlive("GET /S HTTP/1.1\r\nHost: 10.0.0.1\r\n\r\n") &&
+                                keepsAlive(CHECK_REQUESTS[5]));
+  check("HTTP/1.0 closes", !keepsAlive(CHECK_REQUESTS[1]));
+  check("HTTP/1.0 keep-alive", keepsAlive(CHECK_REQUESTS[2]));
+  check("Connection: close", !keepsAlive(REQUESTS[3]) && !keepsAlive(CHECK_REQUESTS[3]));
+  check("Connection in a header value", keepsAlive(CHECK_REQUESTS[4]));
+
+  // Any split of the bytes in two blocks parses as byte by byte
+  ok = true;
+  for (int r = 0; r < REQUESTS_COUNT + CHECK_REQUESTS_COUNT; r++) {
+    const char* request = (r < REQUESTS_COUNT) ? REQUESTS[r] : CHECK_REQUESTS[r - REQUESTS_COUNT];
+    parser.begin();
+    ParseOutcome expected = parseBytes(parser, request);
+    for (int split = 0; split <= (int)strlen(request); split++) {
+      parser.begin();
+      ok = ok && parseSplit(parser, request, split) == expected;
+    }
+  }
+  check("Split requests", ok);
+
+  // The requests sent back to back are all found, whatever the blocks
+  std::string stream;
+  for (int r = 0; r < REQUESTS_COUNT; r++) {
+    stream += REQUESTS[r];
+  }
+  ok = true;
+  for (int block = 1; block <= HTTP_READ_BLOCK; block++) {
+    int found = 0;
+    int size = (int)stream.size();
+    parser.begin();
+    for (int start = 0; start < size; start += block) {
+      int end = (size - start < block) ? size : start + block;
+      int next = start;
+      int used;
+      while (next < end && parser.feed(stream.data() + next, end - next, used) != HTTP_PARSE_MORE) {
+        HttpParser single;
+        next += used;
+        parseBytes(single, REQUESTS[found]);
+        ok = ok && found < REQUESTS_COUNT && strcmp(parser.path(), single.path()) == 0 &&
+             strcmp(parser.query(), single.query()) == 0 && parser.error() == single.error();
+        found++;
+        parser.reset();
+      }
+    }
+    ok = ok && found == REQUESTS_COUNT;
+  }
+  check("Pipelined requests", ok);
+}
+
+//! Check the answer heads and when the connections close
+static void checkKeepAlive() {
+  TextPrint out;
+
+  httpRespond(out, 200, "00 00002 b 0", true);
+  bool ok = out.text == "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: 12\r\n"
+                        "Connection: keep-alive\r\n\r\n00 00002 b 0";
+  out.text.clear();
+  httpRespond(out, 404, "", false);
+  check("Answer head", ok && out.text == "HTTP/1.1 404 Not Found\r\nContent-Type: text/plain\r\n"
+                                        "Content-Length: 0\r\nConnection: close\r\n\r\n");
+
+  // The last request of the connection is answered with Connection: close
+  HttpParser parser;
+  int kept = 0;
+  ok = true;
+  for (int i = 1; i <= HTTP_KEEP_ALIVE_REQUESTS + 10; i++) {
+    parseBytes(parser, REQUESTS[0]);
+    kept += parser.keepAlive() ? 1 : 0;
+    ok = ok && parser.keepAlive() == (i < HTTP_KEEP_ALIVE_REQUESTS);
+    parser.reset();
+  }
+  parser.begin();
+  parseBytes(parser, REQUESTS[0]);
+  check("Requests limit", ok && kept == HTTP_KEEP_ALIVE_REQUESTS - 1 && parser.keepAlive());
+
+  // After an error or a request with a body the next request cannot be found
+  check("Close after errors", !keepsAlive("GET /S\r\n\r\n") &&
+                              !keepsAlive(CHECK_REQUESTS[CHECK_REQUESTS_COUNT - 1]));
+  check("Close after non-GET", !keepsAlive("POST /M HTTP/1.1\r\nContent-Length: 4\r\n\r\ne2e4") &&
+                               answer("POST /M HTTP/1.1\r\n\r\n").find("Connection: close\r\n") !=
+                               std::string::npos);
+  check("Keep alive after 404", answer("GET /favicon.ico HTTP/1.1\r\n\r\n").find("Connection: keep-alive\r\n") !=
+                                std::string::npos);
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 2 && strcmp(argv[1], "--check") == 0) {
+    if (strcmp(argv[2], "parser") == 0) {
+      checkParser();
+    }
+    else if (strcmp(argv[2], "keep-alive") == 0) {
+      checkKeepAlive();
+    }
+    else {
+      fprintf(stderr, "Unknown checks: %s\n", argv[2]);
+      return 1;
+    }
+    return failures;
+  }
+
+  long count = (argc > 1) ? atol(argv[1]) : 2000000L;
+
+  measure("Parser bytes", runParser, count);
+  measure("Parser blocks", runParserBlocks, count);
+  measure("String lines", runStringLoop, count);
+  return 0;
+}
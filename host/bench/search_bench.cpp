@@ -0,0 +1,128 @@
+/**
+ * @file search_bench.cpp
+ * @brief Search of a fixed set of positions, for the node counts and the speed
+ *
+ * Usage:
+ *
+ *     search_bench [depth]              search the bench positions to depth (default 5)
+ *     search_bench --time ms "fen"      think on a position within a time budget
+ *     search_bench --smp depth [n]      Lazy SMP scaling from 1 to n threads (default all cores)
+ *
+ * The node counts of the fixed depth run change only when the search changes,
+ * so they measure the effect of the move ordering and of the pruning. The SMP
+ * run searches the bench positions to depth with 1, 2, 4... n threads, from an
+ * empty table every time, and reports the time to depth and the nodes per
+ * second against the single thread.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+#include "chess_moves.h"
+#include "lazy_smp.h"
+#include "search.h"
+#include "transposition.h"
+
+//! Positions of the bench, from the opening to the endgame
+static const char* BENCH_POSITIONS[] = {
+  "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+  "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+  "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+  "r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq - 4 4",
+  "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+  "6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - - 0 1"
+};
+
+//! Number of bench positions
+#define BENCH_SIZE (int)(sizeof(BENCH_POSITIONS) / sizeof(BENCH_POSITIONS[0]))
+
+//! Totals of a run of the bench
+struct BenchTotals {
+  uint64_t nodes = 0;
+  uint64_t ttProbes = 0;
+  uint64_t ttHits = 0;
+  unsigned long elapsed = 0;
+};
+
+//! Search one position, print the outcome if verbose and add it to the totals
+static void run(LazySmp& pool, const char* fen, const SearchLimits& limits, BenchTotals& totals, bool verbose) {
+  Board board;
+  char text[6];
+
+  board.setFen(fen);
+  SearchResult result = pool.think(board, limits);
+  if (verbose) {
+    moveToText(result.best, text);
+    printf("%-6s score %6d depth %2d nodes %10lu time %6lu ms fill %5.1f%%  %s\n", text, result.score,
+           result.depth, (unsigned long)result.nodes, result.elapsed, transpositionTable.fillPermille() / 10.0, fen);
+  }
+  totals.nodes += result.nodes;
+  totals.ttProbes += result.ttProbes;
+  totals.ttHits += result.ttHits;
+  totals.elapsed += result.elapsed;
+}
+
+//! Nodes per second of a run
+static unsigned long long nps(const BenchTotals& totals) {
+  return totals.elapsed ? totals.nodes * 1000 / totals.elapsed : 0;
+}
+
+//! Search the bench positions with 1, 2, 4... threads, from an empty table every time
+static void runSmp(SearchLimits& limits, int maxThreads) {
+  BenchTotals single;
+
+  printf("Threads  Time to depth %d     Nodes        NPS   Speedup  NPS scaling\n", limits.maxDepth);
+  for (int threads = 1; threads <= maxThreads; threads = (threads * 2 > maxThreads && threads < maxThreads) ? maxThreads : threads * 2) {
+    LazySmp pool(threads);
+    BenchTotals totals;
+
+    transpositionTable.clear();
+    for (int i = 0; i < BENCH_SIZE; i++) {
+      run(pool, BENCH_POSITIONS[i], limits, totals, false);
+    }
+    if (threads == 1) {
+      single = totals;
+    }
+    printf("%7d  %10lu ms  %10llu %10llu  %7.2fx  %10.2fx\n", threads, totals.elapsed,
+           (unsigned long long)totals.nodes, nps(totals),
+           totals.elapsed ? (double)single.elapsed / totals.elapsed : 0.0,
+           nps(single) ? (double)nps(totals) / nps(single) : 0.0);
+  }
+}
+
+int main(int argc, char* argv[]) {
+  static LazySmp search(1);
+  SearchLimits limits;
+  BenchTotals totals;
+
+  // The bench measures the search, not the book
+  limits.useBook = false;
+
+  if (argc > 3 && strcmp(argv[1], "--time") == 0) {
+    limits.timeMs = atol(argv[2]);
+    run(search, argv[3], limits, totals, true);
+    printf("Transposition table: hit rate %.1f%%, fill %.1f%%\n",
+           totals.ttProbes ? 100.0 * totals.ttHits / totals.ttProbes : 0.0, transpositionTable.fillPermille() / 10.0);
+    return 0;
+  }
+
+  limits.timeMs = 3600000UL;
+  if (argc > 2 && strcmp(argv[1], "--smp") == 0) {
+    int cores = (int)std::thread::hardware_concurrency();
+    limits.maxDepth = atoi(argv[2]);
+    runSmp(limits, (argc > 3) ? atoi(argv[3]) : (cores > 0 ? cores : 1));
+    return 0;
+  }
+
+  limits.maxDepth = (argc > 1) ? atoi(argv[1]) : 5;
+  for (int i = 0; i < BENCH_SIZE; i++) {
+    run(search, BENCH_POSITIONS[i], limits, totals, true);
+  }
+  // The fill level is printed by every position: the last one is a short mate search
+  printf("Total: %llu nodes, %lu ms, %llu nps\n", (unsigned long long)totals.nodes, totals.elapsed, nps(totals));
+  printf("Transposition table: %lu KB, hit rate %.1f%%\n",
+         (unsigned long)(TT_SIZE_BYTES >> 10), totals.ttProbes ? 100.0 * totals.ttHits / totals.ttProbes : 0.0);
+  return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file sliders_bench.cpp
+ * @brief Per-query cost of the sliding attacks backends
+ *
+ * Runs the same random set of (square, occupancy) queries through the
+ * Kogge-Stone and the magic bitboards backends and prints the average cost
+ * of a single rook, bishop and queen query.
+ */
+
+#include <chrono>
+#include <stdio.h>
+
+#include "sliders.h"
+
+//! Number of distinct queries
+#define BENCH_QUERIES 4096
+//! Number of passes over the queries
+#define BENCH_PASSES 2000
+
+static uint8_t squares[BENCH_QUERIES];
+static Bitboard occupancies[BENCH_QUERIES];
+
+//! Random occupancy with about a quarter of the squares set, like a middlegame
+static Bitboard randomOccupancy(Bitboard& seed) {
+  Bitboard b[2];
+  for (int i = 0; i < 2; i++) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    b[i] = seed;
+  }
+  return b[0] & b[1];
+}
+
+/**
+ * Time a backend over all the queries
+ *
+ * @param name The label printed with the result
+ * @param attacks The attacks function to measure
+ */
+static void bench(const char* name, Bitboard (*attacks)(uint8_t, Bitboard)) {
+  Bitboard check = 0;
+  auto start = std::chrono::steady_clock::now();
+
+  for (int pass = 0; pass < BENCH_PASSES; pass++) {
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+      check ^= attacks(squares[i], occupancies[i] ^ check);
+    }
+  }
+
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+  printf("%-22s %8.2f ns/query  (check %016llx)\n", name,
+         ns / ((double)BENCH_PASSES * BENCH_QUERIES), (unsigned long long)check);
+}
+
+static Bitboard koggeQueenAttacks(uint8_t s, Bitboard occupied) {
+  return koggeRookAttacks(s, occupied) | koggeBishopAttacks(s, occupied);
+}
+
+static Bitboard magicRook(uint8_t s, Bitboard occupied) { return magicRookAttacks(s, occupied); }
+static Bitboard magicBishop(uint8_t s, Bitboard occupied) { return magicBishopAttacks(s, occupied); }
+static Bitboard magicQueen(uint8_t s, Bitboard occupied) {
+  return magicRookAttacks(s, occupied) | magicBishopAttacks(s, occupied);
+}
+
+int main() {
+  Bitboard seed = 0x2545F4914F6CDD1DULL;
+
+  initSliders();
+
+  for (int i = 0; i < BENCH_QUERIES; i++) {
+    occupancies[i] = randomOccupancy(seed);
+    squares[i] = (uint8_t)(seed & 63);
+  }
+
+  bench("kogge-stone rook", koggeRookAttacks);
+  bench("kogge-stone bishop", koggeBishopAttacks);
+  bench("kogge-stone queen", koggeQueenAttacks);
+  bench("magic rook", magicRook);
+  bench("magic bishop", magicBishop);
+  bench("magic queen", magicQueen);
+
+  return 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file kpk_gen.cpp
+ * @brief Generate the King and pawn against King bitbase of the sketches
+ *
+ * Usage:
+ *
+ *     kpk_gen [kpk_data.cpp]
+ *
+ * Every position is first classified by the rules: invalid, drawn because
+ * the black King captures the pawn or is stalemated, won because the pawn
+ * promotes safely, or unknown. Then the unknown positions are resolved from
+ * the ones they lead to, until a pass changes nothing: white wins if one of
+ * its moves reaches a won position, black draws if one of its moves reaches
+ * a drawn one. The positions still unknown at the end are drawn.
+ *
+ * The bitbase is written as the PROGMEM table of the sketches.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "attack_tables.h"
+#include "kpk.h"
+
+#define RESULT_INVALID  0   //!< Impossible position
+#define RESULT_UNKNOWN  1   //!< Not resolved yet
+#define RESULT_DRAW     2   //!< Draw
+#define RESULT_WIN      3   //!< White wins
+
+//! Classification of every position, by kpkIndex()
+static std::vector<uint8_t> results(KPK_POSITIONS);
+
+//! Classify a position by the rules, without looking at the moves
+static uint8_t initialResult(ChessColor turn, uint8_t whiteKing, uint8_t pawn, uint8_t blackKing) {
+  Bitboard pawnAttacks = PAWN_ATTACKS[PLAY_WHITE][pawn];
+  uint8_t promotion = pawn + 8;
+
+  if (whiteKing == blackKing || whiteKing == pawn || blackKing == pawn ||
+      (KING_ATTACKS[whiteKing] & squareMask(blackKing)) ||
+      (turn == PLAY_WHITE && (pawnAttacks & squareMask(blackKing)))) {
+    return RESULT_INVALID;
+  }
+
+  if (turn == PLAY_WHITE) {
+    // The pawn promotes and the new queen cannot be captured
+    if (squareY(pawn) == 6 && whiteKing != promotion && blackKing != promotion &&
+        (!(KING_ATTACKS[blackKing] & squareMask(promotion)) || (KING_ATTACKS[whiteKing] & squareMask(promotion)))) {
+      return RESULT_WIN;
+    }
+  }
+  else {
+    Bitboard escapes = KING_ATTACKS[blackKing] & ~KING_ATTACKS[whiteKing] & ~pawnAttacks;
+
+    // The black King takes the undefended pawn, or it has no moves and no check gives the stalemate
+    if ((escapes & squareMask(pawn)) || (escapes == 0 && !(pawnAttacks & squareMask(blackKing)))) {
+      return RESULT_DRAW;
+    }
+  }
+  return RESULT_UNKNOWN;
+}
+
+//! Resolve an unknown position from the positions reached by its moves
+static uint8_t resolve(ChessColor turn, uint8_t whiteKing, uint8_t pawn, uint8_t blackKing) {
+  bool allResolved = true;
+
+  if (turn == PLAY_WHITE) {
+    Bitboard targets = KING_ATTACKS[whiteKing] & ~KING_ATTACKS[blackKing] & ~squareMask(pawn);
+    Bitboard pawnTargets = 0;
+
+    // The promotions are classified by the rules, only the pushes inside the bitbase are moves here
+    if (squareY(pawn) < 6 && pawn + 8 != whiteKing && pawn + 8 != blackKing) {
+      pawnTargets |= squareMask(pawn + 8);
+      if (squareY(pawn) == 1 && pawn + 16 != whiteKing && pawn + 16 != blackKing) {
+        pawnTargets |= squareMask(pawn + 16);
+      }
+    }
+
+    while (targets) {
+      uint8_t r = results[kpkIndex(PLAY_BLACK, popFirstSquare(targets), pawn, blackKing)];
+      if (r == RESULT_WIN) {
+        return RESULT_WIN;
+      }
+      allResolved = allResolved && r != RESULT_UNKNOWN;
+    }
+    while (pawnTargets) {
+      uint8_t r = results[kpkIndex(PLAY_BLACK, whiteKing, popFirstSquare(pawnTargets), blackKing)];
+      if (r == RESULT_WIN) {
+        return RESULT_WIN;
+      }
+      allResolved = allResolved && r != RESULT_UNKNOWN;
+    }
+    return allResolved ? RESULT_DRAW : RESULT_UNKNOWN;
+  }
+
+  // A capture of the pawn is a draw classified by the rules, here the King only moves to free squares
+  Bitboard targets = KING_ATTACKS[blackKing] & ~KING_ATTACKS[whiteKing] &
+                     ~PAWN_ATTACKS[PLAY_WHITE][pawn] & ~squareMask(pawn);
+  while (targets) {
+    uint8_t r = results[kpkIndex(PLAY_WHITE, whiteKing, pawn, popFirstSquare(targets))];
+    if (r == RESULT_DRAW) {
+      return RESULT_DRAW;
+    }
+    allResolved = allResolved && r != RESULT_UNKNOWN;
+  }
+  return allResolved ? RESULT_WIN : RESULT_UNKNOWN;
+}
+
+//! Call f for every position of the bitbase
+template<class F> static void forEachPosition(F f) {
+  for (int turn = PLAY_WHITE; turn <= PLAY_BLACK; turn++) {
+    for (int p = 0; p < KPK_PAWN_SQUARES; p++) {
+      uint8_t pawn = squareAt(p % 4, p / 4 + 1);
+      for (uint8_t wk = 0; wk < BOARD_SQUARES; wk++) {
+        for (uint8_t bk = 0; bk < BOARD_SQUARES; bk++) {
+          f((ChessColor)turn, wk, pawn, bk);
+        }
+      }
+    }
+  }
+}
+
+int main(int argc, char* argv[]) {
+  const char* path = (argc > 1) ? argv[1] : "kpk_data.cpp";
+  int passes = 0;
+  bool changed = true;
+
+  forEachPosition([](ChessColor turn, uint8_t wk, uint8_t pawn, uint8_t bk) {
+    results[kpkIndex(turn, wk, pawn, bk)] = initialResult(turn, wk, pawn, bk);
+  });
+  while (changed) {
+    changed = false;
+    passes++;
+    forEachPosition([&changed](ChessColor turn, uint8_t wk, uint8_t pawn, uint8_t bk) {
+      uint8_t& r = results[kpkIndex(turn, wk, pawn, bk)];
+      if (r == RESULT_UNKNOWN && (r = resolve(turn, wk, pawn, bk)) != RESULT_UNKNOWN) {
+        changed = true;
+      }
+    });
+  }
+
+  static uint32_t words[KPK_WORDS];
+  unsigned long counts[4] = { 0, 0, 0, 0 };
+  for (uint32_t i = 0; i < KPK_POSITIONS; i++) {
+    counts[results[i]]++;
+    if (results[i] == RESULT_WIN) {
+      words[i / 32] |= (uint32_t)1 << (i % 32);
+    }
+  }
+
+  FILE* file = fopen(path, "w");
+  if (file == NULL) {
+    fprintf(stderr, "Cannot write %s\n", path);
+    return 1;
+  }
+  fprintf(file, "/**\n * @file kpk_data.cpp\n");
+  fprintf(file, " * @brief King and pawn against King bitbase, generated by kpk_gen\n */\n\n");
+  fprintf(file, "#include \"kpk.h\"\n\n");
+  fprintf(file, "const uint32_t KPK_BITBASE[KPK_WORDS] PROGMEM = {\n");
+  for (uint32_t i = 0; i < KPK_WORDS; i++) {
+    fprintf(file, "%s0x%08lX%s", (i % 8) ? " " : "  ", (unsigned long)words[i],
+            (i + 1 == KPK_WORDS) ? "\n" : (i % 8 == 7) ? ",\n" : ",");
+  }
+  fprintf(file, "};\n");
+  if (fclose(file) != 0) {
+    fprintf(stderr, "Cannot write %s\n", path);
+    return 1;
+  }
+
+  printf("%d passes: %lu won, %lu drawn (%lu unknown), %lu invalid positions\n", passes,
+         counts[RESULT_WIN], counts[RESULT_DRAW] + counts[RESULT_UNKNOWN], counts[RESULT_UNKNOWN],
+         counts[RESULT_INVALID]);
+  return 0;
+}
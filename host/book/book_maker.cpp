@@ -0,0 +1,337 @@
+/**
+ * @file book_maker.cpp
+ * @brief Build the opening book of the sketches from a PGN collection
+ *
+ * Usage:
+ *
+ *     book_maker [-p plies] [-w weight] [-c book.cpp] games.pgn book.bin
+ *
+ *     -p plies      moves of every game added to the book (default 16)
+ *     -w weight     lowest weight of the moves kept (default 1)
+ *     -c book.cpp   also write the records as the PROGMEM table of the sketches
+ *
+ * Every move of the first plies of every game is a (Zobrist hash, move)
+ * record, weighted 2 when the side moving won the game, 1 for a draw or an
+ * unknown result and 0 for a loss, the weights of the same record summed on
+ * all the games. The book is written as little-endian 12-byte records, 8 of
+ * hash, 2 of move and 2 of weight, sorted by hash and by decreasing weight.
+ */
+
+#include <algorithm>
+#include <ctype.h>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "chess_moves.h"
+#include "opening_book.h"
+
+//! Largest weight of a record
+#define BOOK_WEIGHT_MAX 65535
+
+//! Largest number of records, counted by a uint16_t in the sketches
+#define BOOK_RECORDS_MAX 65535
+
+//! A record of the book
+struct Record {
+  uint64_t key;
+  Move move;
+  uint16_t weight;
+};
+
+//! Weights summed by position and move
+typedef std::map<std::pair<uint64_t, Move>, uint32_t> WeightMap;
+
+/**
+ * Find the legal move written in Standard Algebraic Notation
+ *
+ * @param board The position
+ * @param san The move, e.g. "e4", "Nbd2", "exd5", "e8=Q", "O-O", with or
+ * without the check and annotation marks
+ *
+ * @return The move, MOVE_NONE if it is not legal or it is ambiguous
+ */
+static Move sanToMove(const Board& board, const std::string& san) {
+  static const char PIECE_LETTERS[] = "KQBNR";
+  std::string text = san;
+  MoveList list;
+  Move found = MOVE_NONE;
+
+  while (!text.empty() && strchr("+#!?", text.back())) {
+    text.pop_back();
+  }
+  board.generateMoves(list);
+
+  // Castling, written with letter O or digit zero
+  if (text == "O-O" || text == "0-0" || text == "O-O-O" || text == "0-0-0") {
+    int file = (text.length() == 3) ? 6 : 2;
+    for (int i = 0; i < list.count; i++) {
+      if (moveFlags(list.moves[i]) == MOVE_FLAG_CASTLING && (moveTo(list.moves[i]) & 7) == file) {
+        return list.moves[i];
+      }
+    }
+    return MOVE_NONE;
+  }
+
+  // Piece letter, pawns have none
+  ChessPiece piece = PAWN;
+  size_t start = 0;
+  const char* letter = text.empty() ? NULL : strchr(PIECE_LETTERS, text[0]);
+  if (letter != NULL && *letter) {
+    piece = (ChessPiece)(letter - PIECE_LETTERS);
+    start = 1;
+  }
+
+  // Promotion piece, with or without the equal sign
+  ChessPiece promotion = EMPTY;
+  if (!text.empty() && (letter = strchr(PIECE_LETTERS + 1, text.back())) != NULL && *letter &&
+      text.length() > start + 2) {
+    promotion = (ChessPiece)(letter - PIECE_LETTERS);
+    text.pop_back();
+    if (!text.empty() && text.back() == '=') {
+      text.pop_back();
+    }
+  }
+
+  // Destination square, the characters before it disambiguate the origin
+  if (text.length() < start + 2) {
+    return MOVE_NONE;
+  }
+  int to = textToSquare(text.c_str() + text.length() - 2);
+  int fromFile = -1;
+  int fromRank = -1;
+  for (size_t i = start; i < text.length() - 2; i++) {
+    if (text[i] >= 'a' && text[i] <= 'h') {
+      fromFile = text[i] - 'a';
+    }
+    else if (text[i] >= '1' && text[i] <= '8') {
+      fromRank = text[i] - '1';
+    }
+    else if (text[i] != 'x') {
+      return MOVE_NONE;
+    }
+  }
+  if (to < 0) {
+    return MOVE_NONE;
+  }
+
+  for (int i = 0; i < list.count; i++) {
+    Move m = list.moves[i];
+    bool promotes = moveFlags(m) == MOVE_FLAG_PROMOTION;
+    if (moveTo(m) != to || codePiece(board.getPieceCode(moveFrom(m))) != piece ||
+        moveFlags(m) == MOVE_FLAG_CASTLING ||
+        (fromFile >= 0 && (moveFrom(m) & 7) != fromFile) ||
+        (fromRank >= 0 && (moveFrom(m) >> 3) != fromRank) ||
+        promotes != (promotion != EMPTY) || (promotes && movePromotion(m) != promotion)) {
+      continue;
+    }
+    if (found != MOVE_NONE) {
+      return MOVE_NONE;
+    }
+    found = m;
+  }
+  return found;
+}
+
+//! Add the moves of a game to the book, weighted by its result
+static void addGame(WeightMap& weights, const std::vector<std::pair<uint64_t, Move> >& moves, const std::string& result) {
+  for (size_t i = 0; i < moves.size(); i++) {
+    bool whiteMoves = (i % 2) == 0;
+    uint32_t weight = 1;
+    if (result == "1-0") {
+      weight = whiteMoves ? 2 : 0;
+    }
+    else if (result == "0-1") {
+      weight = whiteMoves ? 0 : 2;
+    }
+    weights[moves[i]] += weight;
+  }
+}
+
+/**
+ * Read the games of a PGN file and sum the weights of their first moves
+ *
+ * @return The number of games read
+ */
+static int readPgn(FILE* file, int plies, WeightMap& weights) {
+  std::vector<std::pair<uint64_t, Move> > moves;
+  std::string token;
+  Board board;
+  bool skipGame = false;
+  int games = 0;
+  int c;
+
+  board.setBoard();
+  while ((c = fgetc(file)) != EOF) {
+    // Tags, comments and variations are skipped, the result ends the game
+    if (c == '[') {
+      while ((c = fgetc(file)) != EOF && c != ']') { }
+      continue;
+    }
+    if (c == '{') {
+      while ((c = fgetc(file)) != EOF && c != '}') { }
+      continue;
+    }
+    if (c == ';') {
+      while ((c = fgetc(file)) != EOF && c != '\n') { }
+      continue;
+    }
+    if (c == '(') {
+      for (int depth = 1; depth > 0 && (c = fgetc(file)) != EOF; ) {
+        depth += (c == '(') ? 1 : (c == ')') ? -1 : 0;
+      }
+      continue;
+    }
+    if (!isspace(c)) {
+      token += (char)c;
+      continue;
+    }
+    if (token.empty()) {
+      continue;
+    }
+
+    if (token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*") {
+      addGame(weights, moves, token);
+      moves.clear();
+      board.setBoard();
+      skipGame = false;
+      games++;
+    }
+    else if (token[0] != '$' && !skipGame) {
+      // Move numbers, as "12." or "12...", may be attached to the move
+      size_t i = 0;
+      while (i < token.length() && isdigit((unsigned char)token[i]) && token.compare(0, 3, "0-0") != 0) {
+        i++;
+      }
+      if (i > 0 && i < token.length() && token[i] == '.') {
+        while (i < token.length() && token[i] == '.') {
+          i++;
+        }
+        token.erase(0, i);
+      }
+
+      if (!token.empty()) {
+        Move m = sanToMove(board, token);
+        if (m == MOVE_NONE) {
+          fprintf(stderr, "Game %d: invalid move %s, the rest of the game is skipped\n", games + 1, token.c_str());
+          skipGame = true;
+        }
+        else if ((int)moves.size() < plies) {
+          moves.push_back(std::make_pair(board.getHash(), m));
+          board.makeMove(m);
+        }
+        else {
+          skipGame = true;
+        }
+      }
+    }
+    token.clear();
+  }
+  return games;
+}
+
+//! Write the records as the PROGMEM table of the sketches
+static bool writeSource(const char* path, const char* pgn, const std::vector<Record>& records) {
+  FILE* file = fopen(path, "w");
+  char text[6];
+
+  if (file == NULL) {
+    return false;
+  }
+  fprintf(file, "/**\n * @file opening_book_data.cpp\n");
+  fprintf(file, " * @brief Opening book records, generated by book_maker from %s\n */\n\n", pgn);
+  fprintf(file, "#include \"opening_book.h\"\n\n");
+  fprintf(file, "const BookEntry OPENING_BOOK[] PROGMEM = {\n");
+  for (size_t i = 0; i < records.size(); i++) {
+    moveToText(records[i].move, text);
+    fprintf(file, "  { 0x%08lXUL, 0x%08lXUL, 0x%04X, %5u },  // %s\n",
+            (unsigned long)(records[i].key >> 32), (unsigned long)(records[i].key & 0xFFFFFFFFUL),
+            records[i].move, records[i].weight, text);
+  }
+  fprintf(file, "};\n\n");
+  fprintf(file, "const uint16_t OPENING_BOOK_SIZE = sizeof(OPENING_BOOK) / sizeof(OPENING_BOOK[0]);\n");
+  return fclose(file) == 0;
+}
+
+//! Write the records in the little-endian binary format
+static bool writeBinary(const char* path, const std::vector<Record>& records) {
+  FILE* file = fopen(path, "wb");
+
+  if (file == NULL) {
+    return false;
+  }
+  for (size_t i = 0; i < records.size(); i++) {
+    uint8_t bytes[12];
+    for (int b = 0; b < 8; b++) {
+      bytes[b] = (uint8_t)(records[i].key >> (8 * b));
+    }
+    bytes[8] = (uint8_t)records[i].move;
+    bytes[9] = (uint8_t)(records[i].move >> 8);
+    bytes[10] = (uint8_t)records[i].weight;
+    bytes[11] = (uint8_t)(records[i].weight >> 8);
+    fwrite(bytes, sizeof(bytes), 1, file);
+  }
+  return fclose(file) == 0;
+}
+
+int main(int argc, char* argv[]) {
+  const char* source = NULL;
+  int plies = 16;
+  unsigned long minWeight = 1;
+  int i;
+
+  for (i = 1; i + 1 < argc && argv[i][0] == '-'; i += 2) {
+    if (strcmp(argv[i], "-p") == 0) {
+      plies = atoi(argv[i + 1]);
+    }
+    else if (strcmp(argv[i], "-w") == 0) {
+      minWeight = strtoul(argv[i + 1], NULL, 10);
+    }
+    else if (strcmp(argv[i], "-c") == 0) {
+      source = argv[i + 1];
+    }
+    else {
+      break;
+    }
+  }
+  if (i + 2 != argc) {
+    fprintf(stderr, "Usage: book_maker [-p plies] [-w weight] [-c book.cpp] games.pgn book.bin\n");
+    return 1;
+  }
+
+  FILE* pgn = fopen(argv[i], "r");
+  if (pgn == NULL) {
+    fprintf(stderr, "Cannot open %s\n", argv[i]);
+    return 1;
+  }
+  WeightMap weights;
+  int games = readPgn(pgn, plies, weights);
+  fclose(pgn);
+
+  std::vector<Record> records;
+  for (WeightMap::const_iterator it = weights.begin(); it != weights.end(); ++it) {
+    if (it->second >= minWeight && it->second > 0) {
+      Record r = { it->first.first, it->first.second, (uint16_t)std::min(it->second, (uint32_t)BOOK_WEIGHT_MAX) };
+      records.push_back(r);
+    }
+  }
+  std::sort(records.begin(), records.end(), [](const Record& a, const Record& b) {
+    return (a.key != b.key) ? a.key < b.key : a.weight > b.weight;
+  });
+  if (records.empty() || records.size() > BOOK_RECORDS_MAX) {
+    fprintf(stderr, "The book has %u records, it must have 1 to %d\n", (unsigned)records.size(), BOOK_RECORDS_MAX);
+    return 1;
+  }
+
+  if (!writeBinary(argv[i + 1], records) || (source != NULL && !writeSource(source, argv[i], records))) {
+    fprintf(stderr, "Cannot write the book\n");
+    return 1;
+  }
+  printf("%d games, %u records, %u bytes\n", games, (unsigned)records.size(),
+         (unsigned)(records.size() * sizeof(BookEntry)));
+  return 0;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file perft_main.cpp
+ * @brief Host perft tool: reference suite, divide and consistency checks
+ *
+ * Usage:
+ *
+ *     perft [depth] [--verify]          run the reference suite up to depth (default 4)
+ *     perft --verify-only depth         only run the consistency checks of the suite
+ *     perft --divide depth "fen"        print the node count under every root move
+ *
+ * The exit code is the number of failed checks of the suite.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chess_moves.h"
+#include "perft.h"
+
+int main(int argc, char* argv[]) {
+  int depth = 4;
+  bool verify = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--verify") == 0) {
+      verify = true;
+    }
+    else if (strcmp(argv[i], "--divide") == 0 && i + 2 < argc) {
+      Board board;
+      if (!board.setFen(argv[i + 2])) {
+        fprintf(stderr, "Invalid FEN: %s\n", argv[i + 2]);
+        return 1;
+      }
+      perftDivide(board, atoi(argv[i + 1]), &Serial);
+      return 0;
+    }
+    else if (strcmp(argv[i], "--verify-only") == 0 && i + 1 < argc) {
+      Board board;
+      int failures = 0;
+      for (int p = 0; p < PERFT_SUITE_SIZE; p++) {
+        board.setFen(PERFT_SUITE[p].fen);
+        uint32_t errors = perftVerify(board, atoi(argv[i + 1]));
+        Serial << PERFT_SUITE[p].name << ": " << (errors ? "FAILED" : "ok") << endl;
+        failures += errors ? 1 : 0;
+      }
+      return failures;
+    }
+    else {
+      depth = atoi(argv[i]);
+    }
+  }
+
+  return runPerftSuite(&Serial, depth, verify);
+}
@@ -0,0 +1,9 @@
+/**
+ * @file Arduino.cpp
+ * @brief Serial ports of the host Arduino core replacement
+ */
+
+#include "Arduino.h"
+
+HostSerial Serial;
+HostSerial Serial1;
@@ -0,0 +1,162 @@
+/**
+ * @file Arduino.h
+ * @brief Minimal host replacement of the Arduino core used by the chess sources
+ *
+ * Only what the chess core and its host tools need is provided: the Print
+ * class, a minimal String, the Serial ports writing to the standard output,
+ * the millis()/micros() clocks, random() and the PROGMEM accessors.
+ */
+
+#ifndef _HOST_ARDUINO
+#define _HOST_ARDUINO
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+/**
+ * Minimal replacement of the Arduino String class, with the members used by
+ * the sketches
+ */
+class String {
+  std::string text;
+
+public:
+  String(const char* s = "") : text(s) { }
+  String(char c) : text(1, c) { }
+  String(int v) : text(std::to_string(v)) { }
+  String(unsigned long v) : text(std::to_string(v)) { }
+
+  unsigned int length() const { return (unsigned int)text.length(); }
+  const char* c_str() const { return text.c_str(); }
+  char charAt(unsigned int i) const { return i < text.length() ? text[i] : 0; }
+  long toInt() const { return atol(text.c_str()); }
+
+  String& operator+=(const String& s) { text += s.text; return *this; }
+  String& operator+=(const char* s) { text += s; return *this; }
+  String& operator+=(char c) { text += c; return *this; }
+  friend String operator+(String a, const String& b) { return a += b; }
+
+  bool operator==(const String& s) const { return text == s.text; }
+  bool operator!=(const String& s) const { return text != s.text; }
+  bool operator<(const String& s) const { return text < s.text; }
+
+  bool startsWith(const String& s) const { return text.compare(0, s.text.length(), s.text) == 0; }
+  bool endsWith(const String& s) const {
+    return text.length() >= s.text.length() &&
+           text.compare(text.length() - s.text.length(), s.text.length(), s.text) == 0;
+  }
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t i = text.find(c, from);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  String substring(unsigned int from, unsigned int to = 0xFFFFFFFF) const {
+    if (from > text.length()) {
+      return String();
+    }
+    return String(text.substr(from, (to < text.length() ? to : text.length()) - from).c_str());
+  }
+};
+
+//! Base of the output devices, as in the Arduino core
+class Print {
+public:
+  virtual ~Print() { }
+
+  //! Write a single byte. Every device implements it
+  virtual size_t write(uint8_t c) = 0;
+
+  //! Write a block of bytes; the network clients send it at once
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (n < size && write(buffer[n])) {
+      n++;
+    }
+    return n;
+  }
+
+  size_t write(const char* s) { return print(s); }
+
+  size_t print(const char* s) {
+    size_t n = 0;
+    while (*s) {
+      n += write((uint8_t)*s++);
+    }
+    return n;
+  }
+
+  size_t print(char c) { return write((uint8_t)c); }
+
+  size_t print(int v) { return printFormat("%d", v); }
+
+  size_t print(unsigned int v) { return printFormat("%u", v); }
+
+  size_t print(long v) { return printFormat("%ld", v); }
+
+  size_t print(unsigned long v) { return printFormat("%lu", v); }
+
+  size_t print(double v) { return printFormat("%.2f", v); }
+
+  size_t print(const String& s) { return print(s.c_str()); }
+
+  size_t println() { return print("\r\n"); }
+
+  template<class T> size_t println(T v) { return print(v) + println(); }
+
+private:
+  template<class T> size_t printFormat(const char* format, T v) {
+    char text[32];
+    snprintf(text, sizeof(text), format, v);
+    return print(text);
+  }
+};
+
+/**
+ * Serial port of the host: the output goes to the standard output and
+ * there is never input available
+ */
+class HostSerial : public Print {
+public:
+  void begin(unsigned long) { }
+  operator bool() { return true; }
+  int available() { return 0; }
+  int read() { return -1; }
+  size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+  using Print::write;
+};
+
+//! USB serial port
+extern HostSerial Serial;
+
+//! Hardware serial port on the pins 13/14 of the MKR boards
+extern HostSerial Serial1;
+
+//! Milliseconds since the program started
+inline unsigned long millis() {
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - start).count();
+}
+
+//! Microseconds since the program started
+inline unsigned long micros() {
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start).count();
+}
+
+//! Random number from 0 to howbig - 1
+inline long random(long howbig) {
+  return (howbig > 0) ? rand() % howbig : 0;
+}
+
+//! Constant data stays in flash on the boards, the host reads it as any other data
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+
+#endif
@@ -0,0 +1,25 @@
+/**
+ * @file Streaming.h
+ * @brief Host replacement of the Streaming library: the << operator on Print
+ */
+
+#ifndef _HOST_STREAMING
+#define _HOST_STREAMING
+
+#include "Arduino.h"
+
+//! Print any printable value with the << operator
+template<class T> inline Print& operator<<(Print& obj, T arg) {
+  obj.print(arg);
+  return obj;
+}
+
+//! End of line manipulator
+enum _EndLineCode { endl };
+
+inline Print& operator<<(Print& obj, _EndLineCode) {
+  obj.println();
+  return obj;
+}
+
+#endif
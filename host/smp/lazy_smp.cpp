@@ -0,0 +1,46 @@
+/**
+ * @file lazy_smp.cpp
+ * @brief Threads of the Lazy SMP search
+ */
+
+#include <thread>
+
+#include "lazy_smp.h"
+
+LazySmp::LazySmp(int threads) {
+  for (int i = 0; i < (threads > 0 ? threads : 1); i++) {
+    workers.push_back(std::unique_ptr<Search>(new Search()));
+  }
+}
+
+SearchResult LazySmp::think(const Board& position, const SearchLimits& limits) {
+  std::vector<std::thread> helpers;
+  std::vector<SearchResult> results(workers.size());
+  bool stop = false;
+
+  for (size_t i = 1; i < workers.size(); i++) {
+    SearchLimits helperLimits = limits;
+    helperLimits.helper = (int)i;
+    helperLimits.maxDepth = SEARCH_MAX_PLY;
+    helperLimits.yield = NULL;
+    helperLimits.stop = &stop;
+    helpers.push_back(std::thread([this, i, &position, helperLimits, &results]() {
+      results[i] = workers[i]->think(position, helperLimits);
+    }));
+  }
+
+  // The main search ages the table: the first entries stored by the helpers
+  // may have the old generation, they are only replaced sooner
+  SearchLimits mainLimits = limits;
+  mainLimits.helper = 0;
+  SearchResult result = workers[0]->think(position, mainLimits);
+
+  __atomic_store_n(&stop, true, __ATOMIC_RELAXED);
+  for (size_t i = 0; i < helpers.size(); i++) {
+    helpers[i].join();
+    result.nodes += results[i + 1].nodes;
+    result.ttProbes += results[i + 1].ttProbes;
+    result.ttHits += results[i + 1].ttHits;
+  }
+  return result;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file lazy_smp.h
+ * @brief Lazy SMP search of the host build
+ *
+ * The threads of the pool search the same root position, each with its own
+ * Search object, and share only the transposition table: the results found
+ * by a thread prune the search of the others. The main thread decides the
+ * move, the helpers stop when it is done.
+ */
+
+#ifndef _LAZY_SMP
+#define _LAZY_SMP
+
+#include <memory>
+#include <vector>
+
+#include "search.h"
+
+/**
+ * The LazySmp class runs a Search per thread on the same position
+ */
+class LazySmp {
+  //! The searches, the first one is the main search
+  std::vector<std::unique_ptr<Search> > workers;
+
+public:
+  /**
+   * Create the searches of the pool
+   *
+   * @param threads Number of threads, at least 1
+   */
+  explicit LazySmp(int threads);
+
+  //! Number of threads of the pool
+  int threads() const { return (int)workers.size(); }
+
+  /**
+   * Find the best move of a position with all the threads
+   *
+   * @param position The position, not changed by the search
+   * @param limits Deadline and depth of the main search; the helpers search
+   * until the main search is done
+   *
+   * @return The result of the main search, with the nodes and the table
+   * lookups of all the threads
+   */
+  SearchResult think(const Board& position, const SearchLimits& limits);
+};
+
+#endif